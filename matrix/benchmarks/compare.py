@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+"""Сравнение двух JSON-отчётов google-benchmark.
+
+    make bench BENCH_OUT=before.json
+    ... изменения ...
+    make bench BENCH_OUT=after.json
+    python3 benchmarks/compare.py before.json after.json --threshold 5
+
+Для каждого бенчмарка, который есть в обоих отчётах, выводится время
+итерации и его изменение в процентах. Если бенчмарк запускался с
+повторениями (--benchmark_repetitions), сравнивается медиана. Код
+возврата 1, если хотя бы один бенчмарк замедлился больше порога.
+"""
+
+import argparse
+import json
+import sys
+
+# Множители перевода time_unit в наносекунды
+UNITS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load(path):
+    """Время итерации в наносекундах по имени бенчмарка."""
+    with open(path) as f:
+        report = json.load(f)
+
+    iterations, medians = {}, {}
+    for run in report["benchmarks"]:
+        if run.get("error_occurred"):
+            continue
+        time = run["real_time"] * UNITS[run.get("time_unit", "ns")]
+        if run.get("run_type") == "aggregate":
+            if run.get("aggregate_name") == "median":
+                medians[run["run_name"]] = time
+        else:
+            iterations.setdefault(run.get("run_name", run["name"]), time)
+    iterations.update(medians)
+    return iterations
+
+
+def format_time(ns):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if ns >= scale:
+            return "%.3g %s" % (ns / scale, unit)
+    return "%.3g ns" % ns
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline", help="отчёт до изменений")
+    parser.add_argument("contender", help="отчёт после изменений")
+    parser.add_argument("--threshold", type=float, default=5.0,
+                        help="допустимое замедление в процентах (5)")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    contender = load(args.contender)
+    names = [name for name in contender if name in baseline]
+    if not names:
+        sys.exit("No common benchmarks in %s and %s"
+                 % (args.baseline, args.contender))
+
+    width = max(len(name) for name in names)
+    print("%-*s %12s %12s %9s" % (width, "Benchmark", "Baseline",
+                                  "Contender", "Change"))
+    regressions = []
+    for name in names:
+        change = (contender[name] / baseline[name] - 1) * 100
+        mark = ""
+        if change > args.threshold:
+            mark = "  slower"
+            regressions.append(name)
+        elif change < -args.threshold:
+            mark = "  faster"
+        print("%-*s %12s %12s %+8.1f%%%s" % (
+            width, name, format_time(baseline[name]),
+            format_time(contender[name]), change, mark))
+
+    for path, own, other in ((args.baseline, baseline, contender),
+                             (args.contender, contender, baseline)):
+        missing = len(set(own) - set(other))
+        if missing:
+            print("%d benchmark(s) only in %s" % (missing, path))
+
+    if regressions:
+        print("\n%d benchmark(s) slower by more than %g%%"
+              % (len(regressions), args.threshold))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
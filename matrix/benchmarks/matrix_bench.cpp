@@ -0,0 +1,305 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <utility>
+
+#include "../s21_blas.h"
+#include "../s21_matrix_batch.h"
+#include "../s21_matrix_oop.h"
+
+// Счётчики результатов: FLOPS — арифметических операций в секунду,
+// bytes_per_second — байт, прочитанных и записанных операцией, в секунду
+// (без учёта повторных обращений к кэшу). В JSON попадают абсолютные
+// значения, в консоли — с приставками (G, Gi)
+namespace {
+
+constexpr double kElement = sizeof(double);
+
+S21Matrix Random(int rows, int cols, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> value(-1., 1.);
+  S21Matrix m(rows, cols);
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) m(i, j) = value(gen);
+  }
+  return m;
+}
+
+// Случайная матрица с преобладающей диагональю: заведомо невырожденная
+S21Matrix Regular(int n, unsigned seed) {
+  S21Matrix m = Random(n, n, seed);
+  for (int i = 0; i < n; ++i) m(i, i) += n;
+  return m;
+}
+
+void SetFlops(benchmark::State& state, double flops) {
+  state.counters["FLOPS"] =
+      benchmark::Counter(flops, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+void SetBytes(benchmark::State& state, double bytes) {
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes));
+}
+
+// Конструирование, копирование и перемещение
+
+void BM_Construct(benchmark::State& state) {
+  const int n = state.range(0);
+  for (auto _ : state) {
+    S21Matrix m(n, n);
+    benchmark::DoNotOptimize(m.data());
+  }
+  SetBytes(state, kElement * n * n);
+}
+BENCHMARK(BM_Construct)->RangeMultiplier(4)->Range(4, 4096);
+
+void BM_Copy(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21Matrix a = Random(n, n, 1);
+  for (auto _ : state) {
+    S21Matrix m(a);
+    benchmark::DoNotOptimize(m.data());
+  }
+  SetBytes(state, 2 * kElement * n * n);
+}
+BENCHMARK(BM_Copy)->RangeMultiplier(4)->Range(4, 4096);
+
+void BM_Move(benchmark::State& state) {
+  S21Matrix a = Random(64, 64, 1);
+  for (auto _ : state) {
+    S21Matrix m(std::move(a));
+    a = std::move(m);
+    benchmark::DoNotOptimize(a.data());
+  }
+}
+BENCHMARK(BM_Move);
+
+// Поэлементные операции: n^2 операций, два чтения и одна запись на элемент
+
+void BM_SumMatrix(benchmark::State& state) {
+  const int n = state.range(0);
+  S21Matrix a = Random(n, n, 1);
+  const S21Matrix b = Random(n, n, 2);
+  for (auto _ : state) {
+    a.SumMatrix(b);
+    benchmark::ClobberMemory();
+  }
+  SetFlops(state, double(n) * n);
+  SetBytes(state, 3 * kElement * n * n);
+}
+BENCHMARK(BM_SumMatrix)->RangeMultiplier(4)->Range(4, 4096);
+
+void BM_SubMatrix(benchmark::State& state) {
+  const int n = state.range(0);
+  S21Matrix a = Random(n, n, 1);
+  const S21Matrix b = Random(n, n, 2);
+  for (auto _ : state) {
+    a.SubMatrix(b);
+    benchmark::ClobberMemory();
+  }
+  SetFlops(state, double(n) * n);
+  SetBytes(state, 3 * kElement * n * n);
+}
+BENCHMARK(BM_SubMatrix)->RangeMultiplier(4)->Range(4, 4096);
+
+void BM_MulNumber(benchmark::State& state) {
+  const int n = state.range(0);
+  S21Matrix a = Random(n, n, 1);
+  // Множители чередуются, чтобы значения не уходили в бесконечность
+  double factor = 2.;
+  for (auto _ : state) {
+    a.MulNumber(factor);
+    factor = 1. / factor;
+    benchmark::ClobberMemory();
+  }
+  SetFlops(state, double(n) * n);
+  SetBytes(state, 2 * kElement * n * n);
+}
+BENCHMARK(BM_MulNumber)->RangeMultiplier(4)->Range(4, 4096);
+
+void BM_EqMatrix(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21Matrix a = Random(n, n, 1);
+  const S21Matrix b(a);
+  for (auto _ : state) benchmark::DoNotOptimize(a.EqMatrix(b));
+  SetBytes(state, 2 * kElement * n * n);
+}
+BENCHMARK(BM_EqMatrix)->RangeMultiplier(4)->Range(4, 4096);
+
+// Выражение c = a + b * 2 вычисляется за один проход без временных матриц
+void BM_Expression(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21Matrix a = Random(n, n, 1);
+  const S21Matrix b = Random(n, n, 2);
+  S21Matrix c(n, n);
+  for (auto _ : state) {
+    c = a + b * 2.;
+    benchmark::ClobberMemory();
+  }
+  SetFlops(state, 2. * n * n);
+  SetBytes(state, 3 * kElement * n * n);
+}
+BENCHMARK(BM_Expression)->RangeMultiplier(4)->Range(4, 4096);
+
+// Умножение, транспонирование, определитель и обратная матрица
+
+void BM_MulMatrix(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21Matrix a = Random(n, n, 1);
+  const S21Matrix b = Random(n, n, 2);
+  for (auto _ : state) {
+    S21Matrix c = a * b;
+    benchmark::DoNotOptimize(c.data());
+  }
+  SetFlops(state, 2. * n * n * n);
+  SetBytes(state, 3 * kElement * n * n);
+}
+BENCHMARK(BM_MulMatrix)
+    ->RangeMultiplier(2)
+    ->Range(4, 4096)
+    ->Unit(benchmark::kMicrosecond);
+
+// C = alpha * A^T * B + beta * C за один проход по C
+void BM_Gemm(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21Matrix a = Random(n, n, 1);
+  const S21Matrix b = Random(n, n, 2);
+  S21Matrix c = Random(n, n, 3);
+  for (auto _ : state) {
+    s21::blas::Gemm(0.5, a, b, -1., c, S21Transpose::kTranspose);
+    benchmark::ClobberMemory();
+  }
+  SetFlops(state, 2. * n * n * n + 2. * n * n);
+  SetBytes(state, 4 * kElement * n * n);
+}
+BENCHMARK(BM_Gemm)
+    ->RangeMultiplier(4)
+    ->Range(4, 1024)
+    ->Unit(benchmark::kMicrosecond);
+
+// y = op(A) * x + beta * y: обход A по строкам и по столбцам
+void BM_Gemv(benchmark::State& state) {
+  const int n = state.range(0);
+  const auto trans = static_cast<S21Transpose>(state.range(1));
+  const S21Matrix a = Random(n, n, 1);
+  const S21Matrix x = Random(n, 1, 2);
+  S21Matrix y = Random(n, 1, 3);
+  for (auto _ : state) {
+    s21::blas::Gemv(1., a, x, 0.5, y, trans);
+    benchmark::ClobberMemory();
+  }
+  SetFlops(state, 2. * n * n);
+  SetBytes(state, kElement * n * n);
+}
+BENCHMARK(BM_Gemv)->ArgsProduct(
+    {benchmark::CreateRange(64, 4096, 4), {0, 1}});
+
+void BM_Axpy(benchmark::State& state) {
+  const int n = state.range(0);
+  S21Matrix y = Random(n, n, 1);
+  const S21Matrix x = Random(n, n, 2);
+  double alpha = 0.5;
+  for (auto _ : state) {
+    s21::blas::Axpy(alpha, x, y);
+    alpha = -alpha;
+    benchmark::ClobberMemory();
+  }
+  SetFlops(state, 2. * n * n);
+  SetBytes(state, 3 * kElement * n * n);
+}
+BENCHMARK(BM_Axpy)->RangeMultiplier(4)->Range(4, 4096);
+
+void BM_Transpose(benchmark::State& state) {
+  const int n = state.range(0);
+  S21Matrix a = Random(n, n + 1, 1);
+  for (auto _ : state) {
+    S21Matrix t = a.Transpose();
+    benchmark::DoNotOptimize(t.data());
+  }
+  SetBytes(state, 2 * kElement * n * (n + 1));
+}
+BENCHMARK(BM_Transpose)->RangeMultiplier(4)->Range(4, 4096);
+
+void BM_Determinant(benchmark::State& state) {
+  const int n = state.range(0);
+  S21Matrix a = Regular(n, 1);
+  for (auto _ : state) benchmark::DoNotOptimize(a.Determinant());
+  SetFlops(state, 2. / 3. * n * n * n);
+  SetBytes(state, kElement * n * n);
+}
+BENCHMARK(BM_Determinant)
+    ->RangeMultiplier(4)
+    ->Range(4, 1024)
+    ->Unit(benchmark::kMicrosecond);
+
+void BM_InverseMatrix(benchmark::State& state) {
+  const int n = state.range(0);
+  S21Matrix a = Regular(n, 1);
+  for (auto _ : state) {
+    S21Matrix inverse = a.InverseMatrix();
+    benchmark::DoNotOptimize(inverse.data());
+  }
+  SetFlops(state, 2. * n * n * n);
+  SetBytes(state, 2 * kElement * n * n);
+}
+BENCHMARK(BM_InverseMatrix)
+    ->RangeMultiplier(4)
+    ->Range(4, 1024)
+    ->Unit(benchmark::kMicrosecond);
+
+// Наборы малых матриц: счётчик matrices/s — обработанных матриц в секунду
+
+constexpr int kBatchCount = 4096;
+
+S21MatrixBatch RandomBatch(int n, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> value(-1., 1.);
+  S21MatrixBatch batch(kBatchCount, n, n);
+  for (int k = 0; k < kBatchCount; ++k) {
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) batch(k, i, j) = value(gen) + (i == j) * n;
+    }
+  }
+  return batch;
+}
+
+void SetMatrices(benchmark::State& state) {
+  state.counters["matrices/s"] = benchmark::Counter(
+      kBatchCount, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+void BM_BatchMulMatrix(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21MatrixBatch a = RandomBatch(n, 1);
+  const S21MatrixBatch b = RandomBatch(n, 2);
+  for (auto _ : state) {
+    S21MatrixBatch c = a * b;
+    benchmark::ClobberMemory();
+  }
+  SetMatrices(state);
+  SetFlops(state, 2. * n * n * n * kBatchCount);
+}
+BENCHMARK(BM_BatchMulMatrix)->DenseRange(2, 8, 2);
+
+void BM_BatchDeterminant(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21MatrixBatch a = RandomBatch(n, 1);
+  for (auto _ : state) benchmark::DoNotOptimize(a.Determinant().data());
+  SetMatrices(state);
+}
+BENCHMARK(BM_BatchDeterminant)->DenseRange(2, 8, 2);
+
+void BM_BatchInverseMatrix(benchmark::State& state) {
+  const int n = state.range(0);
+  const S21MatrixBatch a = RandomBatch(n, 1);
+  for (auto _ : state) {
+    S21MatrixBatch inverse = a.InverseMatrix();
+    benchmark::ClobberMemory();
+  }
+  SetMatrices(state);
+}
+BENCHMARK(BM_BatchInverseMatrix)->DenseRange(2, 8, 2);
+
+}  // namespace
+
+BENCHMARK_MAIN();
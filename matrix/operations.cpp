@@ -1,152 +1,305 @@
 #include "s21_matrix_oop.h"
 
+#include <cmath>
+
+#include "s21_blas.h"
+#include "s21_instrumentation.h"
+#include "s21_lu.h"
+#include "s21_scratch_arena.h"
+#include "s21_simd.h"
+#include "s21_strassen.h"
+#include "s21_thread_pool.h"
+#include "s21_transpose.h"
+
+namespace s21 {
+
 // Проверка на равенство матриц
-bool S21Matrix::EqMatrix(const S21Matrix& other) const {
+template <class T>
+bool Matrix<T>::EqMatrix(const Matrix& other) const {
   if (rows_ != other.rows_ || cols_ != other.cols_)
     return false;  // Если размеры матриц не совпадают, возвращаем false
+  S21_OPERATION(kEqMatrix, std::uint64_t(rows_) * cols_);
 
-  for (auto i = 0; i < rows_; ++i) {
-    for (auto j = 0; j < cols_; ++j) {
-      // Сравниваем каждый элемент матрицы с соответствующим элементом другой
-      // матрицы с учетом погрешности EPS
-      if (matrix_[i][j] - other.matrix_[i][j] > EPS) return false;
+  const auto& simd = simd::Active<T>();
+  std::atomic<bool> equal{true};
+  auto& pool = S21ThreadPool::instance();
+  pool.forEachRowBlock(rows_, stride_, [&](int begin, int end) {
+    for (auto i = begin; i < end && equal.load(std::memory_order_relaxed);
+         ++i) {
+      // Сравниваем строки поэлементно по модулю разности с учетом погрешности
+      // kEpsilon; выравнивающий хвост строки в сравнении не участвует
+      if (!simd.equal(row(i), other.row(i), cols_, kEpsilon)) equal = false;
     }
-  }
+  });
 
-  return true;  // Если все элементы совпадают с учетом погрешности, возвращаем
-                // true
+  return equal;  // Если все элементы совпадают с учетом погрешности,
+                 // возвращаем true
+}
+
+// Проверка на равенство с частью другой матрицы
+template <class T>
+bool Matrix<T>::EqMatrix(const MatrixView<T>& other) const {
+  if (rows_ != other.getRows() || cols_ != other.getCols()) return false;
+  S21_OPERATION(kEqMatrix, std::uint64_t(rows_) * cols_);
+
+  const auto& simd = simd::Active<T>();
+  std::atomic<bool> equal{true};
+  auto& pool = S21ThreadPool::instance();
+  pool.forEachRowBlock(rows_, cols_, [&](int begin, int end) {
+    for (auto i = begin; i < end && equal.load(std::memory_order_relaxed);
+         ++i) {
+      const auto src = other.row(i);
+      if (other.colStride() == 1) {
+        if (!simd.equal(row(i), src.p, cols_, kEpsilon)) equal = false;
+        continue;
+      }
+      for (auto j = 0; j < cols_; ++j) {
+        if (!(std::abs(row(i)[j] - src[j]) <= kEpsilon)) equal = false;
+      }
+    }
+  });
+  return equal;
 }
 
 // Сложение матриц
-void S21Matrix::SumMatrix(const S21Matrix& other) {
-  if (cols_ != other.rows_)
+template <class T>
+void Matrix<T>::SumMatrix(const Matrix& other) {
+  if (rows_ != other.rows_ || cols_ != other.cols_)
     throw std::invalid_argument(
-        "The number of columns in the first matrix is not equal to the number "
-        "of rows in the second matrix");  // Проверка на соответствие размеров
-                                          // матриц для сложения
+        "Different matrix dimensions");  // Проверка на соответствие размеров
+                                         // матриц для сложения
+  S21_OPERATION(kSumMatrix, std::uint64_t(rows_) * cols_);
 
-  for (auto i = 0; i < rows_; ++i) {
-    for (auto j = 0; j < cols_; ++j) {
-      matrix_[i][j] +=
-          other.matrix_[i][j];  // Сложение соответствующих элементов матриц
-    }
+  blas::Axpy(T(1), other, *this);  // Один векторный проход по буферу
+}
+
+// Сложение с частью матрицы: строки с единичным шагом обрабатываются
+// векторным ядром, остальные поэлементно
+template <class T>
+void Matrix<T>::SumMatrix(const MatrixView<T>& other) {
+  if (rows_ != other.getRows() || cols_ != other.getCols())
+    throw std::invalid_argument("Different matrix dimensions");
+  S21_OPERATION(kSumMatrix, std::uint64_t(rows_) * cols_);
+  if (other.aliases(expr::regionOf(*this))) {
+    SumMatrix(Matrix(other));  // Часть самой матрицы с другими индексами
+    return;
   }
+
+  const auto& simd = simd::Active<T>();
+  auto& pool = S21ThreadPool::instance();
+  pool.forEachRowBlock(rows_, cols_, [&](int begin, int end) {
+    for (auto i = begin; i < end; ++i) {
+      const auto src = other.row(i);
+      if (other.colStride() == 1) {
+        simd.add(row(i), src.p, cols_);
+      } else {
+        for (auto j = 0; j < cols_; ++j) row(i)[j] += src[j];
+      }
+    }
+  });
 }
 
 // Вычитание матриц
-void S21Matrix::SubMatrix(const S21Matrix& other) {
-  if (cols_ != other.rows_)
+template <class T>
+void Matrix<T>::SubMatrix(const Matrix& other) {
+  if (rows_ != other.rows_ || cols_ != other.cols_)
     throw std::invalid_argument(
-        "The number of columns in the first matrix is not equal to the number "
-        "of rows in the second matrix");  // Проверка на соответствие размеров
-                                          // матриц для вычитания
+        "Different matrix dimensions");  // Проверка на соответствие размеров
+                                         // матриц для вычитания
+  S21_OPERATION(kSubMatrix, std::uint64_t(rows_) * cols_);
 
-  for (auto i = 0; i < rows_; ++i) {
-    for (auto j = 0; j < cols_; ++j) {
-      matrix_[i][j] -=
-          other.matrix_[i][j];  // Вычитание соответствующих элементов матриц
-    }
+  blas::Axpy(T(-1), other, *this);
+}
+
+// Вычитание части матрицы
+template <class T>
+void Matrix<T>::SubMatrix(const MatrixView<T>& other) {
+  if (rows_ != other.getRows() || cols_ != other.getCols())
+    throw std::invalid_argument("Different matrix dimensions");
+  S21_OPERATION(kSubMatrix, std::uint64_t(rows_) * cols_);
+  if (other.aliases(expr::regionOf(*this))) {
+    SubMatrix(Matrix(other));
+    return;
   }
+
+  const auto& simd = simd::Active<T>();
+  auto& pool = S21ThreadPool::instance();
+  pool.forEachRowBlock(rows_, cols_, [&](int begin, int end) {
+    for (auto i = begin; i < end; ++i) {
+      const auto src = other.row(i);
+      if (other.colStride() == 1) {
+        simd.sub(row(i), src.p, cols_);
+      } else {
+        for (auto j = 0; j < cols_; ++j) row(i)[j] -= src[j];
+      }
+    }
+  });
 }
 
 // Умножение матриц
-void S21Matrix::MulMatrix(const S21Matrix& other) {
+template <class T>
+void Matrix<T>::MulMatrix(const Matrix& other) {
   if (cols_ != other.rows_)
     throw std::invalid_argument(
         "The number of columns in the first matrix is not equal to the rows in "
         "second matrix");  // Проверка на соответствие размеров матриц для
                            // умножения
+  S21_OPERATION(kMulMatrix, 2 * std::uint64_t(rows_) * cols_ * other.cols_);
 
-  S21Matrix resultMatrix(rows_,
-                         other.cols_);  // Создание матрицы для результата
+  // При beta == 0 результат не читается, поэтому не обнуляется заранее
+  Matrix resultMatrix(rows_, other.cols_, Uninitialized{});
+  blas::Gemm(T(1), *this, other, T(), resultMatrix);  // Блочное умножение
 
-  for (auto i = 0; i < rows_; ++i) {
-    for (auto j = 0; j < other.cols_; ++j) {
-      for (auto k = 0; k < cols_; ++k) {
-        resultMatrix.matrix_[i][j] +=
-            matrix_[i][k] *
-            other.matrix_[k][j];  // Вычисление элементов результирующей матрицы
-      }
-    }
+  *this = std::move(resultMatrix);  // Перенос результата в текущую матрицу
+}
+
+// Умножение на часть матрицы без её копирования
+template <class T>
+void Matrix<T>::MulMatrix(const MatrixView<T>& other) {
+  if (cols_ != other.getRows())
+    throw std::invalid_argument(
+        "The number of columns in the first matrix is not equal to the rows in "
+        "second matrix");
+  S21_OPERATION(kMulMatrix,
+                2 * std::uint64_t(rows_) * cols_ * other.getCols());
+
+  Matrix resultMatrix(rows_, other.getCols(), Uninitialized{});
+  blas::Gemm(T(1), *this, other, T(), resultMatrix);
+  *this = std::move(resultMatrix);
+}
+
+// Умножение матриц выбранным алгоритмом. Штрассен-Виноград выигрывает у
+// классического GEMM только на больших матрицах и даёт большую погрешность,
+// поэтому включается явно; порог перехода задаёт s21::strassen::SetCrossover
+template <class T>
+void Matrix<T>::MulMatrix(const Matrix& other, S21MulAlgorithm algorithm) {
+  if (algorithm == S21MulAlgorithm::kClassic) {
+    MulMatrix(other);
+    return;
   }
+  if (cols_ != other.rows_)
+    throw std::invalid_argument(
+        "The number of columns in the first matrix is not equal to the rows in "
+        "second matrix");
+  S21_OPERATION(kMulMatrix, 2 * std::uint64_t(rows_) * cols_ * other.cols_);
 
-  *this = resultMatrix;  // Присвоение результата текущей матрице
+  Matrix resultMatrix(rows_, other.cols_);
+  strassen::Multiply(rows_, other.cols_, cols_, matrix_, stride_, other.matrix_,
+                     other.stride_, resultMatrix.matrix_, resultMatrix.stride_);
+  *this = std::move(resultMatrix);
+}
+
+// Накопление произведения матриц: this += a * b. Множители передаются в
+// GEMM со своими шагами, поэтому блоки и транспонированные представления не
+// копируются; пересекающиеся с результатом множители копирует blas::Gemm
+template <class T>
+void Matrix<T>::MulAddMatrix(const MatrixView<T>& a, const MatrixView<T>& b) {
+  if (a.getCols() != b.getRows())
+    throw std::invalid_argument(
+        "The number of columns in the first matrix is not equal to the rows in "
+        "second matrix");  // Проверка на соответствие размеров множителей
+  if (rows_ != a.getRows() || cols_ != b.getCols())
+    throw std::invalid_argument(
+        "The size of the accumulator does not match the size of the "
+        "product");  // Проверка на соответствие размеров результата
+  S21_OPERATION(kMulAddMatrix,
+                2 * std::uint64_t(rows_) * cols_ * a.getCols());
+
+  blas::Gemm(T(1), a, b, T(1), *this);
 }
 
 // Умножение матрицы на число
-void S21Matrix::MulNumber(const double num) {
-  for (auto i = 0; i < rows_; ++i) {
-    for (auto j = 0; j < cols_; ++j) {
-      matrix_[i][j] *= num;  // Умножение каждого элемента матрицы на число
-    }
-  }
+template <class T>
+void Matrix<T>::MulNumber(const T num) {
+  S21_OPERATION(kMulNumber, std::uint64_t(rows_) * cols_);
+  blas::Scal(num, *this);  // Умножение каждого элемента матрицы на число
 }
 
-// Транспонирование матрицы
-S21Matrix S21Matrix::Transpose() {
-  S21Matrix resultMatrix(cols_, rows_);  // Создание матрицы для результата
+// Транспонирование матрицы плитками в порядке рекурсивного деления
+template <class T>
+Matrix<T> Matrix<T>::Transpose() {
+  S21_OPERATION(kTranspose, 0);
+  Matrix resultMatrix(cols_, rows_,
+                      Uninitialized{});  // Создание матрицы для результата
 
-  for (auto i = 0; i < rows_; ++i) {
-    for (auto j = 0; j < cols_; ++j) {
-      resultMatrix.matrix_[i][j] =
-          matrix_[j][i];  // Заполнение результата транспонированными элементами
-    }
-  }
+  transpose::Transpose(rows_, cols_, matrix_, stride_, resultMatrix.matrix_,
+                       resultMatrix.stride_);
 
   return resultMatrix;  // Возврат результата
 }
 
+// Транспонирование на месте: квадратная матрица обменивает симметричные
+// плитки без выделения памяти, прямоугольная получает новый буфер
+template <class T>
+void Matrix<T>::TransposeInPlace() {
+  S21_OPERATION(kTransposeInPlace, 0);
+  if (rows_ == cols_) {
+    transpose::TransposeInPlace(rows_, matrix_, stride_);
+  } else {
+    *this = Transpose();
+  }
+}
+
 // Вычисление определителя матрицы
-double S21Matrix::Determinant() {
+template <class T>
+T Matrix<T>::Determinant() {
   if (rows_ != cols_)
     throw std::invalid_argument(
         "The matrix is not square");  // Проверка на квадратность матрицы
+  S21_OPERATION(kDeterminant, 2 * std::uint64_t(rows_) * rows_ * rows_ / 3);
 
   if (rows_ == 1)
-    return matrix_[0][0];  // Для матрицы 1x1 определитель равен её
-                           // единственному элементу
+    return row(0)[0];  // Для матрицы 1x1 определитель равен её
+                       // единственному элементу
 
   if (rows_ == 2)
-    return matrix_[0][0] * matrix_[1][1] -
-           matrix_[0][1] *
-               matrix_[1][0];  // Формула для определителя матрицы 2x2
-
-  double result = 0.;
-  for (auto i = 0; i < rows_; ++i) {
-    S21Matrix tmp(rows_ - 1, cols_ - 1);  // Создание матрицы для минора
-    for (auto j = 1; j < rows_; ++j) {
-      for (auto k = 0; k < cols_; ++k) {
-        if (k < i)
-          tmp.matrix_[j - 1][k] = matrix_[j][k];
-        else if (k > i)
-          tmp.matrix_[j - 1][k - 1] = matrix_[j][k];
-      }
-    }
-    result += matrix_[0][i] * pow(-1, i) *
-              tmp.Determinant();  // Рекурсивное вычисление определителя
-  }
+    return row(0)[0] * row(1)[1] -
+           row(0)[1] * row(1)[0];  // Формула для определителя матрицы 2x2
 
-  return result;  // Возврат результата
+  // Произведение диагонали LU-разложения, построенного во временной арене
+  return LU<T>(*this, &ScratchArena::local()).determinant();
 }
 
 // Вычисление матрицы дополнений
-S21Matrix S21Matrix::CalcComplements() {
+template <class T>
+Matrix<T> Matrix<T>::CalcComplements() {
   if (rows_ != cols_)
     throw std::invalid_argument(
         "The matrix is not square");  // Проверка на квадратность матрицы
+  // Разложение и обращение; путь через миноры вырожденной матрицы не
+  // учитывается отдельно
+  S21_OPERATION(kCalcComplements,
+                (2 * std::uint64_t(rows_) + 1) * rows_ * rows_);
 
-  S21Matrix resultMatrix(rows_, cols_);  // Создание матрицы для результата
+  Matrix resultMatrix(rows_, cols_);  // Создание матрицы для результата
 
   if (rows_ == 1) {
-    resultMatrix.matrix_[0][0] = 1;  // Для матрицы 1x1 её дополнение равно 1
+    resultMatrix.row(0)[0] = 1;  // Для матрицы 1x1 её дополнение равно 1
+    return resultMatrix;
+  }
+
+  // Разложение, обратная матрица и миноры — временные объекты арены потока
+  ScratchArena& arena = ScratchArena::local();
+  LU<T> lu(*this, &arena);
+  if (!lu.isSingular()) {
+    // Для невырожденной матрицы дополнения выражаются через обратную:
+    // A_ij = det(A) * (A^-1)_ji, что требует одного разложения вместо n^2
+    const T determinant = lu.determinant();
+    const Matrix inverse = lu.inverse(&arena);
+    for (auto i = 0; i < rows_; ++i) {
+      for (auto j = 0; j < cols_; ++j) {
+        resultMatrix.row(i)[j] = determinant * inverse.row(j)[i];
+      }
+    }
     return resultMatrix;
   }
 
   for (auto i = 0; i < rows_; ++i) {
     for (auto j = 0; j < cols_; ++j) {
-      resultMatrix.matrix_[i][j] =
-          ((i + j) % 2 ? -1 : 1) *
-          minorMatrix(i, j).Determinant();  // Заполнение матрицы дополнений
+      resultMatrix.row(i)[j] =
+          T((i + j) % 2 ? -1 : 1) *
+          minorMatrix(i, j, &arena)
+              .Determinant();  // Заполнение матрицы дополнений
     }
   }
 
@@ -154,8 +307,10 @@ S21Matrix S21Matrix::CalcComplements() {
 }
 
 // Вычисление минора матрицы
-S21Matrix S21Matrix::minorMatrix(int im, int jm) noexcept {
-  S21Matrix minor(rows_ - 1, cols_ - 1);  // Создание матрицы для минора
+template <class T>
+Matrix<T> Matrix<T>::minorMatrix(int im, int jm,
+                                 std::pmr::memory_resource* resource) noexcept {
+  Matrix minor(rows_ - 1, cols_ - 1, resource);  // Создание матрицы для минора
   int mRow = 0;
   int mCol = 0;
   for (int i = 0; i < rows_; i++) {
@@ -163,7 +318,7 @@ S21Matrix S21Matrix::minorMatrix(int im, int jm) noexcept {
     mCol = 0;
     for (int j = 0; j < cols_; j++) {
       if (j == jm) continue;
-      minor.matrix_[mRow][mCol] = matrix_[i][j];  // Заполнение минора
+      minor.row(mRow)[mCol] = row(i)[j];  // Заполнение минора
       mCol++;
     }
     mRow++;
@@ -172,13 +327,40 @@ S21Matrix S21Matrix::minorMatrix(int im, int jm) noexcept {
 }
 
 // Вычисление обратной матрицы
-S21Matrix S21Matrix::InverseMatrix() {
-  double determinant = Determinant();  // Вычисление определителя
+template <class T>
+Matrix<T> Matrix<T>::InverseMatrix() {
+  S21_OPERATION(kInverseMatrix, 2 * std::uint64_t(rows_) * rows_ * rows_);
+  // LU-разложение с проверкой на квадратность во временной арене
+  LU<T> lu(*this, &ScratchArena::local());
 
-  if (!determinant)
+  if (lu.isSingular())
     throw std::invalid_argument(
         "Matrix determinant is 0");  // Проверка на нулевой определитель
 
-  return CalcComplements().Transpose() *
-         (1. / determinant);  // Вычисление обратной матрицы
+  return lu.inverse();  // Решение A * X = E по готовому разложению
 }
+
+#define S21_INSTANTIATE(T)                                               \
+  template bool Matrix<T>::EqMatrix(const Matrix<T>&) const;             \
+  template bool Matrix<T>::EqMatrix(const MatrixView<T>&) const;         \
+  template void Matrix<T>::SumMatrix(const Matrix<T>&);                  \
+  template void Matrix<T>::SumMatrix(const MatrixView<T>&);              \
+  template void Matrix<T>::SubMatrix(const Matrix<T>&);                  \
+  template void Matrix<T>::SubMatrix(const MatrixView<T>&);              \
+  template void Matrix<T>::MulNumber(const T);                           \
+  template void Matrix<T>::MulMatrix(const Matrix<T>&);                  \
+  template void Matrix<T>::MulMatrix(const MatrixView<T>&);              \
+  template void Matrix<T>::MulMatrix(const Matrix<T>&, S21MulAlgorithm); \
+  template void Matrix<T>::MulAddMatrix(const MatrixView<T>&,            \
+                                        const MatrixView<T>&);           \
+  template Matrix<T> Matrix<T>::Transpose();                             \
+  template void Matrix<T>::TransposeInPlace();                           \
+  template T Matrix<T>::Determinant();                                   \
+  template Matrix<T> Matrix<T>::CalcComplements();                       \
+  template Matrix<T> Matrix<T>::minorMatrix(                             \
+      int, int, std::pmr::memory_resource*) noexcept;                    \
+  template Matrix<T> Matrix<T>::InverseMatrix();
+S21_MATRIX_ELEMENT_TYPES(S21_INSTANTIATE)
+#undef S21_INSTANTIATE
+
+}  // namespace s21
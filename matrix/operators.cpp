@@ -1,81 +1,132 @@
 #include "s21_matrix_oop.h"
 
+#include "s21_blas.h"
+#include "s21_instrumentation.h"
+
+namespace s21 {
+
 // Перегрузка оператора присваивания для копирования
-S21Matrix& S21Matrix::operator=(S21Matrix const& other) {
-  if (this != &other) {
-    S21Matrix tmp(other);  // Создание временной копии
+template <class T>
+Matrix<T>& Matrix<T>::operator=(Matrix const& other) {
+  if (this == &other) return *this;
+
+  if (rows_ == other.rows_ && cols_ == other.cols_ && matrix_) {
+    // Размеры совпадают: копирование в уже выделенный буфер
+    const std::size_t bytes =
+        sizeof(T) * static_cast<std::size_t>(rows_) * stride_;
+    std::memcpy(matrix_, other.matrix_, bytes);
+    S21_COUNT(kDeepCopies, 1);
+    S21_COUNT(kBytesCopied, bytes);
+  } else {
+    Matrix tmp(other, resource_);  // Копия в том же ресурсе памяти
     swap(tmp);  // Обмен текущего объекта с временным
   }
   return *this;
 }
 
 // Перегрузка оператора присваивания для перемещения
-S21Matrix& S21Matrix::operator=(S21Matrix&& other) {
+template <class T>
+Matrix<T>& Matrix<T>::operator=(Matrix&& other) noexcept {
   if (this != &other) {
-    S21Matrix tmp(other);  // Создание временной копии
-    swap(tmp);  // Обмен текущего объекта с временным
+    freeMemory();  // Освобождение собственного буфера
+    rows_ = std::exchange(other.rows_, 0);  // Забираем буфер другой матрицы
+    cols_ = std::exchange(other.cols_, 0);
+    stride_ = std::exchange(other.stride_, 0);
+    matrix_ = std::exchange(other.matrix_, nullptr);
+    resource_ = other.resource_;
+    S21_COUNT(kMoves, 1);
   }
   return *this;
 }
 
-// Перегрузка оператора сложения матриц
-S21Matrix S21Matrix::operator+(const S21Matrix& other) const {
-  S21Matrix res(*this);  // Создание копии текущей матрицы
-  res.SumMatrix(other);  // Сложение с другой матрицей
-  return res;            // Возврат результата
-}
-
-// Перегрузка оператора вычитания матриц
-S21Matrix S21Matrix::operator-(const S21Matrix& other) const {
-  S21Matrix res(*this);  // Создание копии текущей матрицы
-  res.SubMatrix(other);  // Вычитание другой матрицы
-  return res;            // Возврат результата
-}
-
 // Перегрузка оператора сложения с присваиванием
-S21Matrix& S21Matrix::operator+=(const S21Matrix& other) {
+template <class T>
+Matrix<T>& Matrix<T>::operator+=(const Matrix& other) {
   this->SumMatrix(other);  // Сложение с другой матрицей
   return *this;
 }
 
 // Перегрузка оператора вычитания с присваиванием
-S21Matrix& S21Matrix::operator-=(const S21Matrix& other) {
+template <class T>
+Matrix<T>& Matrix<T>::operator-=(const Matrix& other) {
   this->SubMatrix(other);  // Вычитание другой матрицы
   return *this;
 }
 
 // Перегрузка оператора умножения матриц
-S21Matrix S21Matrix::operator*(const S21Matrix& other) const {
-  S21Matrix res(*this);  // Создание копии текущей матрицы
-  res.MulMatrix(other);  // Умножение на другую матрицу
-  return res;            // Возврат результата
+template <class T>
+Matrix<T> Matrix<T>::operator*(const Matrix& other) const {
+  if (cols_ != other.rows_)
+    throw std::invalid_argument(
+        "The number of columns in the first matrix is not equal to the rows in "
+        "second matrix");  // Проверка на соответствие размеров матриц
+  S21_OPERATION(kMulMatrix, 2 * std::uint64_t(rows_) * cols_ * other.cols_);
+
+  // Результат записывается GEMM с beta == 0 и заранее не обнуляется
+  Matrix res(rows_, other.cols_, Uninitialized{});
+  blas::Gemm(T(1), *this, other, T(), res);
+  return res;  // Возврат результата
 }
 
-// Перегрузка оператора умножения матрицы на число
-S21Matrix S21Matrix::operator*(const double num) const {
-  S21Matrix res(*this);  // Создание копии текущей матрицы
-  res.MulNumber(num);  // Умножение на число
-  return res;          // Возврат результата
+// Умножение на часть матрицы без её копирования
+template <class T>
+Matrix<T> Matrix<T>::operator*(const MatrixView<T>& other) const {
+  return MatrixView<T>(*this) * other;
 }
 
 // Перегрузка оператора умножения с присваиванием матрицы
-S21Matrix& S21Matrix::operator*=(const S21Matrix& other) {
+template <class T>
+Matrix<T>& Matrix<T>::operator*=(const Matrix& other) {
   this->MulMatrix(other);  // Умножение на другую матрицу
   return *this;
 }
 
+// Умножение на часть матрицы с присваиванием
+template <class T>
+Matrix<T>& Matrix<T>::operator*=(const MatrixView<T>& other) {
+  this->MulMatrix(other);
+  return *this;
+}
+
 // Перегрузка оператора умножения с присваиванием на число
-S21Matrix& S21Matrix::operator*=(const double num) {
+template <class T>
+Matrix<T>& Matrix<T>::operator*=(const T num) {
   this->MulNumber(num);  // Умножение на число
   return *this;
 }
 
 // Перегрузка оператора сравнения матриц на равенство
-bool S21Matrix::operator==(const S21Matrix& other) const {
+template <class T>
+bool Matrix<T>::operator==(const Matrix& other) const {
   return EqMatrix(other);  // Сравнение матриц на равенство
 }
 
+// Сравнение с частью матрицы
+template <class T>
+bool Matrix<T>::operator==(const MatrixView<T>& other) const {
+  return EqMatrix(other);
+}
+
 // Перегрузка оператора доступа к элементу матрицы по индексам
-double& S21Matrix::operator()(int i, int j) const {
+template <class T>
+T& Matrix<T>::operator()(int i, int j) const {
   return getElem(i, j);  // Получение ссылки на элемент матрицы
 }
+
+#define S21_INSTANTIATE(T)                                             \
+  template Matrix<T>& Matrix<T>::operator=(Matrix<T> const&);          \
+  template Matrix<T>& Matrix<T>::operator=(Matrix<T>&&) noexcept;      \
+  template Matrix<T>& Matrix<T>::operator+=(const Matrix<T>&);         \
+  template Matrix<T>& Matrix<T>::operator-=(const Matrix<T>&);         \
+  template Matrix<T> Matrix<T>::operator*(const Matrix<T>&) const;     \
+  template Matrix<T> Matrix<T>::operator*(const MatrixView<T>&) const; \
+  template Matrix<T>& Matrix<T>::operator*=(const Matrix<T>&);         \
+  template Matrix<T>& Matrix<T>::operator*=(const MatrixView<T>&);     \
+  template Matrix<T>& Matrix<T>::operator*=(const T);                  \
+  template bool Matrix<T>::operator==(const Matrix<T>&) const;         \
+  template bool Matrix<T>::operator==(const MatrixView<T>&) const;     \
+  template T& Matrix<T>::operator()(int, int) const;
+S21_MATRIX_ELEMENT_TYPES(S21_INSTANTIATE)
+#undef S21_INSTANTIATE
+
+}  // namespace s21
@@ -0,0 +1,291 @@
+#include "s21_blas.h"
+
+#include <algorithm>
+
+#include "s21_gemm.h"
+#include "s21_instrumentation.h"
+#include "s21_simd.h"
+#include "s21_thread_pool.h"
+
+namespace s21 {
+namespace blas {
+
+namespace {
+
+// Длина участка вектора, который Gemv держит в буфере на стеке
+constexpr int kChunk = 256;
+
+// Ядра выбираются загрузчиком по CPUID (кроме сборки с ThreadSanitizer, см.
+// s21_gemm.cpp)
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && \
+    !defined(__SANITIZE_THREAD__)
+#define S21_BLAS_CLONES                                            \
+  __attribute__((target_clones("avx512f", "avx2,fma", "default")))
+#else
+#define S21_BLAS_CLONES
+#endif
+
+// Скалярное произведение непрерывных массивов. Несколько независимых сумм
+// позволяют векторизовать цикл без изменения порядка сложения внутри
+// каждой суммы; комплексное умножение расписано по частям, как в
+// микроядре GEMM
+template <class T>
+S21_BLAS_CLONES T Dot(const T* a, const T* b, int n) {
+  constexpr int kLanes = 32;
+  if constexpr (ElementTraits<T>::kComplex) {
+    using Real = RealOf<T>;
+    const Real* pa = reinterpret_cast<const Real*>(a);
+    const Real* pb = reinterpret_cast<const Real*>(b);
+    Real re[kLanes] = {};
+    Real im[kLanes] = {};
+    int i = 0;
+    for (; i + kLanes <= n; i += kLanes) {
+      for (int s = 0; s < kLanes; ++s) {
+        const Real ar = pa[2 * (i + s)];
+        const Real ai = pa[2 * (i + s) + 1];
+        const Real br = pb[2 * (i + s)];
+        const Real bi = pb[2 * (i + s) + 1];
+        re[s] += ar * br - ai * bi;
+        im[s] += ar * bi + ai * br;
+      }
+    }
+    for (; i < n; ++i) {
+      re[0] += pa[2 * i] * pb[2 * i] - pa[2 * i + 1] * pb[2 * i + 1];
+      im[0] += pa[2 * i] * pb[2 * i + 1] + pa[2 * i + 1] * pb[2 * i];
+    }
+    Real sumRe = 0;
+    Real sumIm = 0;
+    for (int s = 0; s < kLanes; ++s) {
+      sumRe += re[s];
+      sumIm += im[s];
+    }
+    return T(sumRe, sumIm);
+  } else {
+    T acc[kLanes] = {};
+    int i = 0;
+    for (; i + kLanes <= n; i += kLanes) {
+      for (int s = 0; s < kLanes; ++s) acc[s] += a[i + s] * b[i + s];
+    }
+    for (; i < n; ++i) acc[0] += a[i] * b[i];
+    T sum = T();
+    for (int s = 0; s < kLanes; ++s) sum += acc[s];
+    return sum;
+  }
+}
+
+#undef S21_BLAS_CLONES
+
+// Элементы строки или столбца: p[i * step], i < size
+template <class T>
+struct Vector {
+  T* p;
+  std::ptrdiff_t step;
+  int size;
+};
+
+template <class T>
+Vector<T> VectorOf(const MatrixView<T>& v) {
+  if (v.getCols() == 1) return {v.data(), v.rowStride(), v.getRows()};
+  if (v.getRows() == 1) return {v.data(), v.colStride(), v.getCols()};
+  throw std::invalid_argument("The matrix is not a vector");
+}
+
+// y[i] = beta * y[i] + value; при beta == 0 прежнее значение не читается
+template <class T>
+void Update(T& y, T beta, T value) {
+  y = beta == T() ? value : beta * y + value;
+}
+
+// op(A) с непрерывными строками: скалярные произведения строк на x. x
+// собирается участками в буфер на стеке, поэтому шаг x не важен; каждый
+// участок строк A читается один раз
+template <class T>
+void GemvRows(T alpha, const MatrixView<T>& a, const Vector<T>& x, T beta,
+              const Vector<T>& y) {
+  const int m = a.getRows();
+  const int n = a.getCols();
+  S21ThreadPool::instance().forEachRowBlock(m, n, [&](int begin, int end) {
+    T chunk[kChunk];
+    for (int c = 0; c < n; c += kChunk) {
+      const int len = std::min(kChunk, n - c);
+      const T* xc = x.p + c * x.step;
+      if (x.step != 1) {
+        for (int j = 0; j < len; ++j) chunk[j] = xc[j * x.step];
+        xc = chunk;
+      }
+      for (int i = begin; i < end; ++i) {
+        const T value = alpha * Dot(a.data() + i * a.rowStride() + c, xc, len);
+        T& dst = y.p[i * y.step];
+        if (c == 0) {
+          Update(dst, beta, value);
+        } else {
+          dst += value;
+        }
+      }
+    }
+  });
+}
+
+// op(A) с непрерывными столбцами: y накапливается участками на стеке как
+// сумма столбцов A с весами alpha * x[j] и записывается один раз
+template <class T>
+void GemvColumns(T alpha, const MatrixView<T>& a, const Vector<T>& x, T beta,
+                 const Vector<T>& y) {
+  const int m = a.getRows();
+  const int n = a.getCols();
+  const auto& simd = simd::Active<T>();
+  const int chunks = (m + kChunk - 1) / kChunk;
+  S21ThreadPool::instance().forEachRowBlock(
+      chunks, kChunk * n, [&](int begin, int end) {
+        T acc[kChunk];
+        for (int c = begin; c < end; ++c) {
+          const int r = c * kChunk;
+          const int len = std::min(kChunk, m - r);
+          std::fill(acc, acc + len, T());
+          for (int j = 0; j < n; ++j) {
+            simd.axpy(acc, alpha * x.p[j * x.step],
+                      a.data() + j * a.colStride() + r, len);
+          }
+          for (int i = 0; i < len; ++i)
+            Update(y.p[(r + i) * y.step], beta, acc[i]);
+        }
+      });
+}
+
+// Произвольные шаги op(A)
+template <class T>
+void GemvStrided(T alpha, const MatrixView<T>& a, const Vector<T>& x, T beta,
+                 const Vector<T>& y) {
+  for (int i = 0; i < a.getRows(); ++i) {
+    T sum = T();
+    for (int j = 0; j < a.getCols(); ++j) sum += a(i, j) * x.p[j * x.step];
+    Update(y.p[i * y.step], beta, alpha * sum);
+  }
+}
+
+}  // namespace
+
+template <class T>
+void Gemm(Scalar<T> alpha, const View<T>& a, const View<T>& b, Scalar<T> beta,
+          Matrix<T>& c, S21Transpose transA, S21Transpose transB) {
+  const MatrixView<T> opA =
+      transA == S21Transpose::kTranspose ? a.TransposeView() : a;
+  const MatrixView<T> opB =
+      transB == S21Transpose::kTranspose ? b.TransposeView() : b;
+  if (opA.getCols() != opB.getRows())
+    throw std::invalid_argument(
+        "The number of columns in the first matrix is not equal to the rows in "
+        "second matrix");  // Проверка на соответствие размеров множителей
+  if (c.getRows() != opA.getRows() || c.getCols() != opB.getCols())
+    throw std::invalid_argument(
+        "The size of the accumulator does not match the size of the "
+        "product");  // Проверка на соответствие размеров результата
+  S21_OPERATION(kGemm, 2 * std::uint64_t(c.getRows()) * c.getCols() *
+                           opA.getCols());
+
+  // Ядро читает множители блоками во время записи в результат, поэтому
+  // пересекающийся с результатом множитель сначала копируется
+  const auto target = expr::regionOf(c);
+  if (opA.region().overlaps(target) || opB.region().overlaps(target)) {
+    const Matrix<T> lhs(opA);
+    const Matrix<T> rhs(opB);
+    Gemm(alpha, lhs, rhs, beta, c);
+    return;
+  }
+
+  gemm::Gemm(c.getRows(), c.getCols(), opA.getCols(), alpha, opA.data(),
+             opA.rowStride(), opA.colStride(), opB.data(), opB.rowStride(),
+             opB.colStride(), beta, c.data(), c.stride());
+}
+
+// Обход выбирается по расположению op(A) в памяти: по строкам, если они
+// непрерывны, иначе по столбцам
+template <class T>
+void Gemv(Scalar<T> alpha, const View<T>& a, const View<T>& x, Scalar<T> beta,
+          Matrix<T>& y, S21Transpose trans) {
+  const MatrixView<T> opA =
+      trans == S21Transpose::kTranspose ? a.TransposeView() : a;
+  const Vector<T> vx = VectorOf(x);
+  const Vector<T> vy = VectorOf(MatrixView<T>(y));
+  if (opA.getCols() != vx.size)
+    throw std::invalid_argument(
+        "The number of columns in the first matrix is not equal to the rows in "
+        "second matrix");
+  if (opA.getRows() != vy.size)
+    throw std::invalid_argument(
+        "The size of the accumulator does not match the size of the "
+        "product");
+  S21_OPERATION(kGemv, 2 * std::uint64_t(opA.getRows()) * opA.getCols());
+
+  // Пересекающийся с y множитель сначала копируется
+  const auto target = expr::regionOf(y);
+  if (x.region().overlaps(target)) {
+    const Matrix<T> copy(x);
+    Gemv(alpha, opA, copy, beta, y);
+    return;
+  }
+  if (opA.region().overlaps(target)) {
+    const Matrix<T> copy(opA);
+    Gemv(alpha, copy, x, beta, y);
+    return;
+  }
+
+  if (opA.colStride() == 1) {
+    GemvRows(alpha, opA, vx, beta, vy);
+  } else if (opA.rowStride() == 1) {
+    GemvColumns(alpha, opA, vx, beta, vy);
+  } else {
+    GemvStrided(alpha, opA, vx, beta, vy);
+  }
+}
+
+// Одинаковые размеры дают одинаковый шаг строк, поэтому блоки строк
+// обрабатываются целиком одним векторным проходом
+template <class T>
+void Axpy(Scalar<T> alpha, const Matrix<T>& x, Matrix<T>& y) {
+  if (x.getRows() != y.getRows() || x.getCols() != y.getCols())
+    throw std::invalid_argument("Different matrix dimensions");
+  S21_OPERATION(kAxpy, 2 * std::uint64_t(y.getRows()) * y.getCols());
+
+  const auto& simd = simd::Active<T>();
+  const std::ptrdiff_t stride = y.stride();
+  S21ThreadPool::instance().forEachRowBlock(
+      y.getRows(), stride, [&](int begin, int end) {
+        T* dst = y.data() + begin * stride;
+        const T* src = x.data() + begin * stride;
+        const auto count = static_cast<std::size_t>(end - begin) * stride;
+        if (alpha == T(1)) {
+          simd.add(dst, src, count);
+        } else if (alpha == T(-1)) {
+          simd.sub(dst, src, count);
+        } else {
+          simd.axpy(dst, alpha, src, count);
+        }
+      });
+}
+
+template <class T>
+void Scal(Scalar<T> alpha, Matrix<T>& x) {
+  S21_OPERATION(kScal, std::uint64_t(x.getRows()) * x.getCols());
+
+  const auto& simd = simd::Active<T>();
+  const std::ptrdiff_t stride = x.stride();
+  S21ThreadPool::instance().forEachRowBlock(
+      x.getRows(), stride, [&](int begin, int end) {
+        simd.scale(x.data() + begin * stride, alpha,
+                   static_cast<std::size_t>(end - begin) * stride);
+      });
+}
+
+#define S21_INSTANTIATE(T)                                                \
+  template void Gemm<T>(T, const MatrixView<T>&, const MatrixView<T>&, T, \
+                        Matrix<T>&, S21Transpose, S21Transpose);          \
+  template void Gemv<T>(T, const MatrixView<T>&, const MatrixView<T>&, T, \
+                        Matrix<T>&, S21Transpose);                        \
+  template void Axpy<T>(T, const Matrix<T>&, Matrix<T>&);                 \
+  template void Scal<T>(T, Matrix<T>&);
+S21_MATRIX_ELEMENT_TYPES(S21_INSTANTIATE)
+#undef S21_INSTANTIATE
+
+}  // namespace blas
+}  // namespace s21
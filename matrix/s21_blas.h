@@ -0,0 +1,57 @@
+#ifndef S21_BLAS_H
+#define S21_BLAS_H
+
+#include "s21_matrix_oop.h"
+#include "s21_matrix_view.h"
+
+// Операция над множителем в Gemm и Gemv
+enum class S21Transpose { kNone, kTranspose };
+
+namespace s21 {
+namespace blas {
+
+namespace detail {
+template <class T>
+struct Identity {
+  using type = T;
+};
+}  // namespace detail
+
+// Тип элементов выводится только из результата: матрицы-множители
+// приводятся к представлениям, а alpha и beta — к типу элементов
+template <class T>
+using Scalar = typename detail::Identity<T>::type;
+template <class T>
+using View = MatrixView<typename detail::Identity<T>::type>;
+
+// Составные операции в духе BLAS: каждая проходит по результату один раз и
+// не создаёт промежуточных матриц. Множители передаются представлениями,
+// поэтому блоки, строки, столбцы и транспонированные части матриц не
+// копируются; копия делается только если множитель пересекается с
+// результатом. Операторы и операции Matrix выполняются через эти функции
+
+// C = alpha * op(A) * op(B) + beta * C. При beta == 0 прежние значения C не
+// читаются
+template <class T>
+void Gemm(Scalar<T> alpha, const View<T>& a, const View<T>& b, Scalar<T> beta,
+          Matrix<T>& c, S21Transpose transA = S21Transpose::kNone,
+          S21Transpose transB = S21Transpose::kNone);
+
+// y = alpha * op(A) * x + beta * y, где x и y — строки или столбцы
+// (матрицы и представления из одной строки или одного столбца)
+template <class T>
+void Gemv(Scalar<T> alpha, const View<T>& a, const View<T>& x, Scalar<T> beta,
+          Matrix<T>& y, S21Transpose trans = S21Transpose::kNone);
+
+// y += alpha * x для матриц одинакового размера
+template <class T>
+void Axpy(Scalar<T> alpha, const Matrix<T>& x, Matrix<T>& y);
+
+// x *= alpha
+template <class T>
+void Scal(Scalar<T> alpha, Matrix<T>& x);
+
+}  // namespace blas
+}  // namespace s21
+
+#endif  // S21_BLAS_H
@@ -0,0 +1,163 @@
+#include "s21_cholesky.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "s21_gemm.h"
+#include "s21_thread_pool.h"
+
+namespace s21 {
+
+// Разложение матрицы a
+template <class T>
+Cholesky<T>::Cholesky(const Matrix<T>& a) : l_(a) {
+  if (a.getRows() != a.getCols())
+    throw std::invalid_argument(
+        "The matrix is not square");  // Проверка на квадратность матрицы
+
+  factorize();
+}
+
+// Правостороннее блочное разложение. Для блока столбцов [k, kEnd):
+// диагональный блок раскладывается построчно, строки L21 независимо решают
+// свои треугольные системы в пуле потоков, L21^H записывается над
+// диагональю, а нижний треугольник A22 -= L21 * L21^H обновляется GEMM по
+// блокам строк
+template <class T>
+void Cholesky<T>::factorize() {
+  using Real = RealOf<T>;
+  const int n = l_.getRows();
+  const std::ptrdiff_t ld = l_.stride();
+  T* a = l_.data();
+  auto& pool = S21ThreadPool::instance();
+
+  // Элемент (i, j) блока L после вычитания вклада столбцов [k, j)
+  const auto reduce = [&](int i, int j, int k) {
+    T sum = a[i * ld + j];
+    for (int c = k; c < j; ++c) sum -= a[i * ld + c] * Conjugate(a[j * ld + c]);
+    return sum / a[j * ld + j];
+  };
+
+  for (int k = 0; k < n; k += kBlock) {
+    const int kEnd = std::min(k + kBlock, n);
+    const int kb = kEnd - k;
+
+    for (int j = k; j < kEnd; ++j) {
+      Real d = std::real(a[j * ld + j]);
+      for (int c = k; c < j; ++c) d -= std::norm(a[j * ld + c]);
+      // Как в LAPACK potrf: матрица не положительно определена, только если
+      // ведущий элемент не положителен (или NaN), независимо от масштаба
+      if (!(d > Real(0))) {
+        positiveDefinite_ = false;
+        return;
+      }
+      a[j * ld + j] = T(std::sqrt(d));
+      for (int i = j + 1; i < kEnd; ++i) a[i * ld + j] = reduce(i, j, k);
+    }
+    for (int j = k; j < kEnd; ++j) {
+      for (int i = j + 1; i < kEnd; ++i)
+        a[j * ld + i] = Conjugate(a[i * ld + j]);
+    }
+    if (kEnd == n) break;
+
+    pool.parallelFor(n - kEnd, kRowGrain, [&](int begin, int end) {
+      for (int i = kEnd + begin; i < kEnd + end; ++i) {
+        for (int j = k; j < kEnd; ++j) {
+          a[i * ld + j] = reduce(i, j, k);
+          a[j * ld + i] = Conjugate(a[i * ld + j]);
+        }
+      }
+    });
+
+    // Блоки строк A22 обновляются независимо, каждый до своей диагонали
+    const int rowBlocks = (n - kEnd + kBlock - 1) / kBlock;
+    pool.parallelFor(rowBlocks, 1, [&](int begin, int end) {
+      for (int b = begin; b < end; ++b) {
+        const int r = kEnd + b * kBlock;
+        const int rEnd = std::min(r + kBlock, n);
+        gemm::MulAdd(rEnd - r, rEnd - kEnd, kb, T(-1), a + r * ld + k, ld, 1,
+                     a + k * ld + kEnd, ld, 1, a + r * ld + kEnd, ld);
+      }
+    });
+  }
+}
+
+template <class T>
+void Cholesky<T>::checkPositiveDefinite() const {
+  if (!positiveDefinite_)
+    throw std::invalid_argument("Matrix is not positive definite");
+}
+
+// Разложение существует только для положительно определённой матрицы
+template <class T>
+bool Cholesky<T>::isPositiveDefinite() const noexcept {
+  return positiveDefinite_;
+}
+
+// det A = det L * det L^H = (l_11 * ... * l_nn)^2
+template <class T>
+T Cholesky<T>::determinant() const {
+  checkPositiveDefinite();
+
+  T result = T(1);
+  for (int i = 0; i < l_.getRows(); ++i) {
+    const T d = l_.data()[i * l_.stride() + i];
+    result *= d * d;
+  }
+  return result;
+}
+
+// Решение системы A * X = B: L * Y = B, затем L^H * X = Y
+template <class T>
+Matrix<T> Cholesky<T>::solve(const Matrix<T>& b) const {
+  if (b.getRows() != l_.getRows())
+    throw std::invalid_argument(
+        "The number of rows in the right-hand side does not match the "
+        "matrix");  // Проверка на соответствие размеров
+  checkPositiveDefinite();
+
+  Matrix<T> x(b);
+  const int n = l_.getRows();
+  triangular::SolveLower(n, x.getCols(), l_.data(), l_.stride(), false,
+                         x.data(), x.stride());
+  triangular::SolveUpper(n, x.getCols(), l_.data(), l_.stride(), x.data(),
+                         x.stride());
+  return x;
+}
+
+// Обратная матрица: L^-1 нижнетреугольная, поэтому прямая подстановка по
+// единичной матрице пропускает нулевые столбцы над диагональю
+template <class T>
+Matrix<T> Cholesky<T>::inverse() const {
+  checkPositiveDefinite();
+
+  const int n = l_.getRows();
+  Matrix<T> x(n, n);
+  for (int i = 0; i < n; ++i) x(i, i) = T(1);
+  triangular::SolveLower(n, n, l_.data(), l_.stride(), false, x.data(),
+                         x.stride(), true);
+  triangular::SolveUpper(n, n, l_.data(), l_.stride(), x.data(), x.stride());
+  return x;
+}
+
+// Множитель L с нулями над диагональю
+template <class T>
+Matrix<T> Cholesky<T>::lower() const {
+  checkPositiveDefinite();
+
+  const int n = l_.getRows();
+  Matrix<T> result(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j <= i; ++j) result(i, j) = l_(i, j);
+  }
+  return result;
+}
+
+template <class T>
+const Matrix<T>& Cholesky<T>::packed() const noexcept { return l_; }
+
+#define S21_INSTANTIATE(T) template class Cholesky<T>;
+S21_MATRIX_ELEMENT_TYPES(S21_INSTANTIATE)
+#undef S21_INSTANTIATE
+
+}  // namespace s21
@@ -0,0 +1,44 @@
+#ifndef S21_CHOLESKY_H
+#define S21_CHOLESKY_H
+
+#include "s21_matrix_oop.h"
+#include "s21_triangular.h"
+
+namespace s21 {
+
+// Разложение Холецкого эрмитовой (для вещественных — симметричной)
+// положительно определённой матрицы: A = L * L^H. Читается только нижний
+// треугольник A. Вдвое дешевле LU и не требует перестановок; разложение
+// выполняется один раз и переиспользуется для решения систем и обращения
+template <class T>
+class Cholesky {
+ public:
+  // Размер блока столбцов для блочного разложения
+  static constexpr int kBlock = triangular::kBlock;
+  // Строк на одну задачу пула потоков при вычислении блока L21
+  static constexpr int kRowGrain = 16;
+
+  explicit Cholesky(const Matrix<T>& a);  // Разложение матрицы a
+
+  bool isPositiveDefinite() const noexcept;  // Удалось ли разложение
+  T determinant() const;  // Определитель: квадрат произведения диагонали L
+  Matrix<T> solve(const Matrix<T>& b) const;  // Решение A * X = B
+  Matrix<T> inverse() const;  // Обратная матрица
+
+  Matrix<T> lower() const;  // Множитель L
+  const Matrix<T>& packed()
+      const noexcept;  // L на диагонали и ниже, L^H выше диагонали
+
+ private:
+  void factorize();  // Блочное разложение на месте
+  void checkPositiveDefinite() const;
+
+  Matrix<T> l_;  // L на диагонали и ниже, L^H выше диагонали
+  bool positiveDefinite_ = true;  // Все ведущие элементы положительны
+};
+
+}  // namespace s21
+
+using S21Cholesky = s21::Cholesky<double>;
+
+#endif  // S21_CHOLESKY_H
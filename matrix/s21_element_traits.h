@@ -0,0 +1,81 @@
+#ifndef S21_ELEMENT_TRAITS_H
+#define S21_ELEMENT_TRAITS_H
+
+#include <complex>
+
+// Поддерживаемые типы элементов s21::Matrix; X(T) раскрывается для каждого.
+// Используется для явного инстанцирования шаблонов в единицах трансляции
+#define S21_MATRIX_ELEMENT_TYPES(X) \
+  X(float)                          \
+  X(double)                         \
+  X(long double)                    \
+  X(std::complex<float>)            \
+  X(std::complex<double>)
+
+namespace s21 {
+
+// Свойства типа элементов: вещественный тип модуля и погрешность сравнения
+// матриц. Погрешность — около 80 машинных эпсилон для float и около
+// 5 * 10^5 для double и 10^6 для long double: достаточно для накопленной
+// ошибки округления в произведениях и разложениях умеренного размера.
+// Порогом вырожденности она не служит: LU (в том числе пакетное) проверяет
+// ведущий элемент на точный нуль, Холецкий — на неположительность, а QR
+// сравнивает R_jj с max(m, n) * eps * ||A(:, j)||, где eps — машинный
+// эпсилон
+template <class T>
+struct ElementTraits;
+
+template <>
+struct ElementTraits<float> {
+  using Real = float;
+  static constexpr Real kEpsilon = 1e-5f;
+  static constexpr bool kComplex = false;
+};
+
+template <>
+struct ElementTraits<double> {
+  using Real = double;
+  static constexpr Real kEpsilon = 1e-10;
+  static constexpr bool kComplex = false;
+};
+
+template <>
+struct ElementTraits<long double> {
+  using Real = long double;
+  static constexpr Real kEpsilon = 1e-13L;
+  static constexpr bool kComplex = false;
+};
+
+// Комплексные элементы сравниваются по модулю разности с погрешностью
+// вещественного типа
+template <class R>
+struct ElementTraits<std::complex<R>> {
+  using Real = R;
+  static constexpr Real kEpsilon = ElementTraits<R>::kEpsilon;
+  static constexpr bool kComplex = true;
+};
+
+template <class T>
+using RealOf = typename ElementTraits<T>::Real;
+
+}  // namespace s21
+
+// Погрешность сравнения матриц double; прежде была макросом
+inline constexpr double EPS = s21::ElementTraits<double>::kEpsilon;
+
+namespace s21 {
+
+// Комплексное сопряжение; для вещественных типов std::conj вернул бы
+// std::complex, поэтому элемент возвращается без изменений
+template <class T>
+T Conjugate(const T& x) {
+  if constexpr (ElementTraits<T>::kComplex) {
+    return std::conj(x);
+  } else {
+    return x;
+  }
+}
+
+}  // namespace s21
+
+#endif  // S21_ELEMENT_TRAITS_H
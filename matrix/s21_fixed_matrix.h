@@ -0,0 +1,301 @@
+#ifndef S21_FIXED_MATRIX_H
+#define S21_FIXED_MATRIX_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_matrix_oop.h"
+
+// Матрица фиксированного размера R x C со встроенным хранилищем: не
+// выделяет память, операции доступны в constexpr. Поэлементные циклы имеют
+// постоянное число итераций, и их разворачивание оставлено компилятору.
+// Определитель, дополнения и обратная матрица для размеров до 4
+// вычисляются явными формулами через миноры без циклов: разложение по
+// строке и матрица дополнений раскрываются свёрткой по std::index_sequence
+template <int R, int C>
+class S21FixedMatrix {
+  static_assert(R > 0 && C > 0, "Zero matrix");
+
+ public:
+  // Конструкторы
+  constexpr S21FixedMatrix() = default;  // Нулевая матрица
+  constexpr S21FixedMatrix(std::initializer_list<double> values) {
+    if (values.size() != static_cast<std::size_t>(R * C))
+      throw std::invalid_argument("Wrong number of values");
+    int k = 0;
+    for (double v : values) data_[k++] = v;
+  }  // Заполнение по строкам
+  explicit S21FixedMatrix(const S21Matrix& other) {
+    if (other.getRows() != R || other.getCols() != C)
+      throw std::invalid_argument("Different matrix dimensions");
+    for (int i = 0; i < R; ++i) {
+      for (int j = 0; j < C; ++j) at(i, j) = other(i, j);
+    }
+  }  // Копирование из динамической матрицы того же размера
+
+  // Преобразование в динамическую матрицу
+  operator S21Matrix() const {
+    S21Matrix result(R, C);
+    result.fillMatrixArr(data_);
+    return result;
+  }
+
+  // Размеры
+  static constexpr int getRows() noexcept { return R; }
+  static constexpr int getCols() noexcept { return C; }
+
+  // Доступ к элементам
+  constexpr double& operator()(int i, int j) {
+    if (i < 0 || i >= R || j < 0 || j >= C)
+      throw std::out_of_range("Index out of range");
+    return at(i, j);
+  }
+  constexpr double operator()(int i, int j) const {
+    if (i < 0 || i >= R || j < 0 || j >= C)
+      throw std::out_of_range("Index out of range");
+    return at(i, j);
+  }
+  constexpr double* data() noexcept { return data_; }
+  constexpr const double* data() const noexcept { return data_; }
+
+  // Операции над матрицами
+  constexpr bool EqMatrix(const S21FixedMatrix& other) const noexcept {
+    for (int k = 0; k < R * C; ++k) {
+      const double diff = data_[k] - other.data_[k];
+      if (!(diff <= EPS && -diff <= EPS)) return false;
+    }
+    return true;
+  }
+  constexpr void SumMatrix(const S21FixedMatrix& other) noexcept {
+    for (int k = 0; k < R * C; ++k) data_[k] += other.data_[k];
+  }
+  constexpr void SubMatrix(const S21FixedMatrix& other) noexcept {
+    for (int k = 0; k < R * C; ++k) data_[k] -= other.data_[k];
+  }
+  constexpr void MulNumber(const double num) noexcept {
+    for (int k = 0; k < R * C; ++k) data_[k] *= num;
+  }
+  constexpr void MulMatrix(const S21FixedMatrix<C, C>& other) noexcept {
+    *this = *this * other;
+  }  // Умножение на месте возможно только на квадратную матрицу
+  constexpr S21FixedMatrix<C, R> Transpose() const noexcept {
+    S21FixedMatrix<C, R> result;
+    for (int i = 0; i < R; ++i) {
+      for (int j = 0; j < C; ++j) result.at(j, i) = at(i, j);
+    }
+    return result;
+  }
+  constexpr S21FixedMatrix<R - 1, C - 1> minorMatrix(int im, int jm) const {
+    S21FixedMatrix<R - 1, C - 1> minor;
+    for (int i = 0, mi = 0; i < R; ++i) {
+      if (i == im) continue;
+      for (int j = 0, mj = 0; j < C; ++j) {
+        if (j == jm) continue;
+        minor.at(mi, mj++) = at(i, j);
+      }
+      ++mi;
+    }
+    return minor;
+  }
+  constexpr double Determinant() const {
+    static_assert(R == C, "The matrix is not square");
+    if constexpr (R == 1) {
+      return data_[0];
+    } else if constexpr (R == 2) {
+      return data_[0] * data_[3] - data_[1] * data_[2];
+    } else if constexpr (R <= 4) {
+      // Разложение по первой строке; миноры меньшего фиксированного
+      // размера, поэтому вся рекурсия раскрывается при компиляции
+      return expandFirstRow(std::make_index_sequence<R>());
+    } else {
+      return eliminationDeterminant();
+    }
+  }
+  constexpr S21FixedMatrix CalcComplements() const {
+    static_assert(R == C, "The matrix is not square");
+    S21FixedMatrix result;
+    if constexpr (R == 1) {
+      result.data_[0] = 1.;
+    } else if constexpr (R <= 4) {
+      result.fillCofactors(*this, std::make_index_sequence<R * C>());
+    } else {
+      for (int i = 0; i < R; ++i) {
+        for (int j = 0; j < C; ++j) {
+          const double minor = minorMatrix(i, j).Determinant();
+          result.at(i, j) = (i + j) % 2 ? -minor : minor;
+        }
+      }
+    }
+    return result;
+  }
+  constexpr S21FixedMatrix InverseMatrix() const {
+    static_assert(R == C, "The matrix is not square");
+    const double determinant = Determinant();
+    if (determinant == 0.)
+      throw std::invalid_argument("Matrix determinant is 0");
+    if constexpr (R <= 4) {
+      // Присоединённая матрица, делённая на определитель
+      return CalcComplements().Transpose() * (1. / determinant);
+    } else {
+      return eliminationInverse();
+    }
+  }
+
+  // Операторы
+  constexpr S21FixedMatrix operator+(const S21FixedMatrix& other) const {
+    S21FixedMatrix result(*this);
+    result.SumMatrix(other);
+    return result;
+  }
+  constexpr S21FixedMatrix operator-(const S21FixedMatrix& other) const {
+    S21FixedMatrix result(*this);
+    result.SubMatrix(other);
+    return result;
+  }
+  constexpr S21FixedMatrix operator*(const double num) const {
+    S21FixedMatrix result(*this);
+    result.MulNumber(num);
+    return result;
+  }
+  template <int K>
+  constexpr S21FixedMatrix<R, K> operator*(
+      const S21FixedMatrix<C, K>& other) const {
+    S21FixedMatrix<R, K> result;
+    for (int i = 0; i < R; ++i) {
+      for (int p = 0; p < C; ++p) {
+        const double a = at(i, p);
+        for (int j = 0; j < K; ++j) result.at(i, j) += a * other.at(p, j);
+      }
+    }
+    return result;
+  }
+  constexpr S21FixedMatrix& operator+=(const S21FixedMatrix& other) {
+    SumMatrix(other);
+    return *this;
+  }
+  constexpr S21FixedMatrix& operator-=(const S21FixedMatrix& other) {
+    SubMatrix(other);
+    return *this;
+  }
+  constexpr S21FixedMatrix& operator*=(const double num) {
+    MulNumber(num);
+    return *this;
+  }
+  constexpr S21FixedMatrix& operator*=(const S21FixedMatrix<C, C>& other) {
+    MulMatrix(other);
+    return *this;
+  }
+  constexpr bool operator==(const S21FixedMatrix& other) const {
+    return EqMatrix(other);
+  }
+
+ private:
+  template <int, int>
+  friend class S21FixedMatrix;
+
+  constexpr double& at(int i, int j) noexcept { return data_[i * C + j]; }
+  constexpr double at(int i, int j) const noexcept { return data_[i * C + j]; }
+
+  static constexpr double abs(double x) noexcept { return x < 0 ? -x : x; }
+
+  // Минор без строки I и столбца J: индексы всех элементов известны при
+  // компиляции
+  template <int I, int J, std::size_t... K>
+  constexpr S21FixedMatrix<R - 1, C - 1> fixedMinor(
+      std::index_sequence<K...>) const noexcept {
+    constexpr int kCols = C - 1;
+    S21FixedMatrix<R - 1, C - 1> minor;
+    ((minor.data_[K] = at(int(K) / kCols + (int(K) / kCols >= I),
+                          int(K) % kCols + (int(K) % kCols >= J))),
+     ...);
+    return minor;
+  }
+
+  // Алгебраическое дополнение элемента (I, J)
+  template <int I, int J>
+  constexpr double cofactor() const noexcept {
+    const double minor =
+        fixedMinor<I, J>(std::make_index_sequence<(R - 1) * (C - 1)>())
+            .Determinant();
+    return (I + J) % 2 ? -minor : minor;
+  }
+
+  template <std::size_t... J>
+  constexpr double expandFirstRow(std::index_sequence<J...>) const noexcept {
+    return (0. + ... + (data_[J] * cofactor<0, int(J)>()));
+  }
+
+  template <std::size_t... K>
+  constexpr void fillCofactors(const S21FixedMatrix& a,
+                               std::index_sequence<K...>) noexcept {
+    ((data_[K] = a.cofactor<int(K) / C, int(K) % C>()), ...);
+  }
+
+  // Определитель методом Гаусса с выбором ведущего элемента для R > 4
+  constexpr double eliminationDeterminant() const {
+    S21FixedMatrix a(*this);
+    double result = 1.;
+    for (int k = 0; k < R; ++k) {
+      int p = k;
+      for (int i = k + 1; i < R; ++i) {
+        if (abs(a.at(i, k)) > abs(a.at(p, k))) p = i;
+      }
+      if (a.at(p, k) == 0.) return 0.;
+      if (p != k) {
+        for (int j = 0; j < C; ++j) {
+          const double tmp = a.at(k, j);
+          a.at(k, j) = a.at(p, j);
+          a.at(p, j) = tmp;
+        }
+        result = -result;
+      }
+      result *= a.at(k, k);
+      for (int i = k + 1; i < R; ++i) {
+        const double l = a.at(i, k) / a.at(k, k);
+        for (int j = k; j < C; ++j) a.at(i, j) -= l * a.at(k, j);
+      }
+    }
+    return result;
+  }
+
+  // Обратная матрица методом Гаусса-Жордана для R > 4
+  constexpr S21FixedMatrix eliminationInverse() const {
+    S21FixedMatrix a(*this);
+    S21FixedMatrix inv;
+    for (int i = 0; i < R; ++i) inv.at(i, i) = 1.;
+    for (int k = 0; k < R; ++k) {
+      int p = k;
+      for (int i = k + 1; i < R; ++i) {
+        if (abs(a.at(i, k)) > abs(a.at(p, k))) p = i;
+      }
+      for (int j = 0; j < C; ++j) {
+        double tmp = a.at(k, j);
+        a.at(k, j) = a.at(p, j);
+        a.at(p, j) = tmp;
+        tmp = inv.at(k, j);
+        inv.at(k, j) = inv.at(p, j);
+        inv.at(p, j) = tmp;
+      }
+      const double pivot = 1. / a.at(k, k);
+      for (int j = 0; j < C; ++j) {
+        a.at(k, j) *= pivot;
+        inv.at(k, j) *= pivot;
+      }
+      for (int i = 0; i < R; ++i) {
+        if (i == k) continue;
+        const double l = a.at(i, k);
+        for (int j = 0; j < C; ++j) {
+          a.at(i, j) -= l * a.at(k, j);
+          inv.at(i, j) -= l * inv.at(k, j);
+        }
+      }
+    }
+    return inv;
+  }
+
+  double data_[R * C] = {};  // Элементы по строкам
+};
+
+#endif  // S21_FIXED_MATRIX_H
@@ -0,0 +1,248 @@
+#include "s21_gemm.h"
+
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <new>
+
+#include "s21_thread_pool.h"
+
+namespace s21 {
+namespace gemm {
+
+namespace {
+
+// Выровненный буфер для упакованных блоков, переиспользуемый между вызовами
+template <class T>
+class PackBuffer {
+ public:
+  PackBuffer() = default;
+  PackBuffer(const PackBuffer&) = delete;
+  PackBuffer& operator=(const PackBuffer&) = delete;
+  ~PackBuffer() { ::operator delete(data_, std::align_val_t(64)); }
+
+  T* get(std::size_t count) {
+    if (count > size_) {
+      ::operator delete(data_, std::align_val_t(64));
+      data_ = nullptr;
+      size_ = 0;
+      data_ = static_cast<T*>(
+          ::operator new(sizeof(T) * count, std::align_val_t(64)));
+      size_ = count;
+    }
+    return data_;
+  }
+
+ private:
+  T* data_ = nullptr;
+  std::size_t size_ = 0;
+};
+
+// Упаковка блока alpha * A (mc x kc) в полосы высотой kMR: внутри полосы
+// элементы идут столбец за столбцом, недостающие строки дополняются нулями
+template <class T>
+void PackA(int mc, int kc, T alpha, const T* a, std::ptrdiff_t rsa,
+           std::ptrdiff_t csa, T* dst) {
+  for (int i = 0; i < mc; i += kMR) {
+    const int mr = std::min(kMR, mc - i);
+    for (int p = 0; p < kc; ++p) {
+      for (int r = 0; r < mr; ++r) dst[r] = alpha * a[(i + r) * rsa + p * csa];
+      for (int r = mr; r < kMR; ++r) dst[r] = T();
+      dst += kMR;
+    }
+  }
+}
+
+// Упаковка панели B (kc x nc) в полосы шириной kNRFor<T>: внутри полосы
+// элементы идут строка за строкой, недостающие столбцы дополняются нулями.
+// Комплексная строка полосы хранится раздельно: kNRFor<T> действительных
+// частей, затем столько же мнимых
+template <class T>
+void PackB(int kc, int nc, const T* b, std::ptrdiff_t rsb, std::ptrdiff_t csb,
+           T* dst) {
+  constexpr int kNRT = kNRFor<T>;
+  for (int j = 0; j < nc; j += kNRT) {
+    const int nr = std::min(kNRT, nc - j);
+    for (int p = 0; p < kc; ++p) {
+      const T* src = b + p * rsb + j * csb;
+      if constexpr (ElementTraits<T>::kComplex) {
+        auto* re = reinterpret_cast<RealOf<T>*>(dst);
+        auto* im = re + kNRT;
+        for (int r = 0; r < nr; ++r) {
+          re[r] = src[r * csb].real();
+          im[r] = src[r * csb].imag();
+        }
+        for (int r = nr; r < kNRT; ++r) re[r] = im[r] = 0;
+      } else {
+        for (int r = 0; r < nr; ++r) dst[r] = src[r * csb];
+        for (int r = nr; r < kNRT; ++r) dst[r] = T();
+      }
+      dst += kNRT;
+    }
+  }
+}
+
+// Микроядро: блок kMR x kNR накапливается в регистрах по всей глубине kc и
+// затем добавляется к C, умноженной на beta (beta == 1 для всех блоков
+// глубины, кроме первого). На краях матрицы записывается только mr x nr
+// часть.
+// Версия под AVX-512/AVX2+FMA выбирается загрузчиком по CPUID (кроме сборки с
+// ThreadSanitizer, который не переносит ifunc-резолверы)
+template <class T>
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && \
+    !defined(__SANITIZE_THREAD__)
+__attribute__((target_clones("avx512f", "avx2,fma", "default")))
+#endif
+void MicroKernel(int kc, const T* __restrict a, const T* __restrict b, T beta,
+                 T* c, std::ptrdiff_t ldc, int mr, int nr) {
+  constexpr int kNRT = kNRFor<T>;
+  T acc[kMR][kNRT] = {};
+  if constexpr (ElementTraits<T>::kComplex) {
+    // Комплексное умножение расписано по частям: operator* для
+    // std::complex вызывает библиотечную функцию с проверкой на NaN и не
+    // векторизуется
+    using Real = RealOf<T>;
+    Real re[kMR][kNRT] = {};
+    Real im[kMR][kNRT] = {};
+    const Real* pa = reinterpret_cast<const Real*>(a);
+    const Real* pb = reinterpret_cast<const Real*>(b);
+    for (int p = 0; p < kc; ++p) {
+      for (int r = 0; r < kMR; ++r) {
+        const Real ar = pa[2 * r];
+        const Real ai = pa[2 * r + 1];
+        for (int s = 0; s < kNRT; ++s) {
+          re[r][s] += ar * pb[s] - ai * pb[kNRT + s];
+          im[r][s] += ar * pb[kNRT + s] + ai * pb[s];
+        }
+      }
+      pa += 2 * kMR;
+      pb += 2 * kNRT;
+    }
+    for (int r = 0; r < kMR; ++r) {
+      for (int s = 0; s < kNRT; ++s) acc[r][s] = T(re[r][s], im[r][s]);
+    }
+  } else {
+    for (int p = 0; p < kc; ++p) {
+      for (int r = 0; r < kMR; ++r) {
+        const T ar = a[r];
+        for (int s = 0; s < kNRT; ++s) acc[r][s] += ar * b[s];
+      }
+      a += kMR;
+      b += kNRT;
+    }
+  }
+
+  if (beta != T(1)) {
+    // Первый блок глубины: прежнее значение C умножается на beta, а при
+    // beta == 0 не читается
+    for (int r = 0; r < mr; ++r) {
+      for (int s = 0; s < nr; ++s) {
+        T& dst = c[r * ldc + s];
+        dst = beta == T() ? acc[r][s] : beta * dst + acc[r][s];
+      }
+    }
+  } else if (mr == kMR && nr == kNRT) {
+    for (int r = 0; r < kMR; ++r) {
+      for (int s = 0; s < kNRT; ++s) c[r * ldc + s] += acc[r][s];
+    }
+  } else {
+    for (int r = 0; r < mr; ++r) {
+      for (int s = 0; s < nr; ++s) c[r * ldc + s] += acc[r][s];
+    }
+  }
+}
+
+// C = beta * C без произведения (k == 0 или alpha == 0)
+template <class T>
+void ScaleC(int m, int n, T beta, T* c, std::ptrdiff_t ldc) {
+  if (beta == T(1)) return;
+  for (int i = 0; i < m; ++i) {
+    T* row = c + i * ldc;
+    if (beta == T()) {
+      std::fill(row, row + n, T());
+    } else {
+      for (int j = 0; j < n; ++j) row[j] *= beta;
+    }
+  }
+}
+
+// Однопоточное блочное умножение
+template <class T>
+void GemmSerial(int m, int n, int k, T alpha, const T* a, std::ptrdiff_t rsa,
+                std::ptrdiff_t csa, const T* b, std::ptrdiff_t rsb,
+                std::ptrdiff_t csb, T beta, T* c, std::ptrdiff_t ldc) {
+  constexpr int kNRT = kNRFor<T>;
+  thread_local PackBuffer<T> bufA;
+  thread_local PackBuffer<T> bufB;
+  const int ncMax = std::min(kNC, (n + kNRT - 1) / kNRT * kNRT);
+  const int mcMax = std::min(kMC, (m + kMR - 1) / kMR * kMR);
+  T* packedB = bufB.get(static_cast<std::size_t>(kKC) * ncMax);
+  T* packedA = bufA.get(static_cast<std::size_t>(kKC) * mcMax);
+
+  for (int jc = 0; jc < n; jc += kNC) {
+    const int nc = std::min(kNC, n - jc);
+    for (int pc = 0; pc < k; pc += kKC) {
+      const int kc = std::min(kKC, k - pc);
+      PackB(kc, nc, b + pc * rsb + jc * csb, rsb, csb, packedB);
+      for (int ic = 0; ic < m; ic += kMC) {
+        const int mc = std::min(kMC, m - ic);
+        PackA(mc, kc, alpha, a + ic * rsa + pc * csa, rsa, csa, packedA);
+        for (int jr = 0; jr < nc; jr += kNRT) {
+          const int nr = std::min(kNRT, nc - jr);
+          for (int ir = 0; ir < mc; ir += kMR) {
+            const int mr = std::min(kMR, mc - ir);
+            MicroKernel(kc, packedA + ir * kc, packedB + jr * kc,
+                        pc == 0 ? beta : T(1), c + (ic + ir) * ldc + jc + jr,
+                        ldc, mr, nr);
+          }
+        }
+      }
+    }
+  }
+}
+
+}  // namespace
+
+template <class T>
+void Gemm(int m, int n, int k, T alpha, const T* a, std::ptrdiff_t rsa,
+          std::ptrdiff_t csa, const T* b, std::ptrdiff_t rsb,
+          std::ptrdiff_t csb, T beta, T* c, std::ptrdiff_t ldc) {
+  if (m <= 0 || n <= 0) return;
+  if (k <= 0 || alpha == T()) {
+    ScaleC(m, n, beta, c, ldc);
+    return;
+  }
+
+  // Малые произведения не окупают распределение по потокам
+  constexpr double kParallelWork = 64. * 64. * 64.;
+  const int tilesM = (m - 1) / kTileM + 1;
+  const int tilesN = (n - 1) / kTileN + 1;
+  auto& pool = S21ThreadPool::instance();
+  if (static_cast<double>(m) * n * k < kParallelWork ||
+      tilesM * tilesN == 1 || pool.getThreadCount() == 1) {
+    GemmSerial(m, n, k, alpha, a, rsa, csa, b, rsb, csb, beta, c, ldc);
+    return;
+  }
+
+  // Плитки C независимы: каждая задача упаковывает свои блоки A и B в
+  // собственные буферы потока
+  pool.parallelFor(tilesM * tilesN, 1, [&](int begin, int end) {
+    for (int tile = begin; tile < end; ++tile) {
+      const int i = tile / tilesN * kTileM;
+      const int j = tile % tilesN * kTileN;
+      GemmSerial(std::min(kTileM, m - i), std::min(kTileN, n - j), k, alpha,
+                 a + i * rsa, rsa, csa, b + j * csb, rsb, csb, beta,
+                 c + i * ldc + j, ldc);
+    }
+  });
+}
+
+#define S21_INSTANTIATE(T)                                       \
+  template void Gemm(int, int, int, T, const T*, std::ptrdiff_t, \
+                     std::ptrdiff_t, const T*, std::ptrdiff_t,   \
+                     std::ptrdiff_t, T, T*, std::ptrdiff_t);
+S21_MATRIX_ELEMENT_TYPES(S21_INSTANTIATE)
+#undef S21_INSTANTIATE
+
+}  // namespace gemm
+}  // namespace s21
@@ -0,0 +1,60 @@
+#ifndef S21_GEMM_H
+#define S21_GEMM_H
+
+#include <complex>
+#include <cstddef>
+
+#include "s21_element_traits.h"
+
+namespace s21 {
+namespace gemm {
+
+// Размеры блоков: MC x KC блок A помещается в L2, KC x NR полоса B — в L1,
+// MR x NR блок C держится в регистрах микроядра
+// Ширина полосы B подобрана под тип элементов: при такой ширине компилятор
+// держит накопители микроядра в векторных регистрах (для float — два
+// регистра AVX-512 на строку, для double — один)
+template <class T>
+constexpr int kNRFor = 4;
+template <>
+constexpr int kNRFor<float> = 32;
+template <>
+constexpr int kNRFor<double> = 8;
+template <>
+constexpr int kNRFor<std::complex<float>> = 32;
+
+constexpr int kMR = 4;
+constexpr int kNR = kNRFor<double>;
+constexpr int kMC = 128;
+constexpr int kKC = 256;
+constexpr int kNC = 4096;
+
+// Плитка C, обрабатываемая одной задачей пула потоков; ширина кратна kNRFor
+// для всех поддерживаемых типов
+constexpr int kTileM = kMC;
+constexpr int kTileN = 32 * kNR;
+
+// C(m x n) = alpha * A(m x k) * B(k x n) + beta * C.
+// Элемент A(i, p) лежит в a[i * rsa + p * csa], B(p, j) — в b[p * rsb + j *
+// csb], C(i, j) — в c[i * ldc + j]. C не должна пересекаться с A и B.
+// Умножение на beta выполняется микроядром при первой записи блока C, поэтому
+// C проходится один раз; при beta == 0 прежнее содержимое C не читается и
+// может быть неинициализированным. Большие произведения делятся на плитки C
+// и считаются в пуле потоков. Инстанцирован для типов S21_MATRIX_ELEMENT_TYPES
+template <class T>
+void Gemm(int m, int n, int k, T alpha, const T* a, std::ptrdiff_t rsa,
+          std::ptrdiff_t csa, const T* b, std::ptrdiff_t rsb,
+          std::ptrdiff_t csb, T beta, T* c, std::ptrdiff_t ldc);
+
+// C(m x n) += alpha * A(m x k) * B(k x n)
+template <class T>
+void MulAdd(int m, int n, int k, T alpha, const T* a, std::ptrdiff_t rsa,
+            std::ptrdiff_t csa, const T* b, std::ptrdiff_t rsb,
+            std::ptrdiff_t csb, T* c, std::ptrdiff_t ldc) {
+  Gemm(m, n, k, alpha, a, rsa, csa, b, rsb, csb, T(1), c, ldc);
+}
+
+}  // namespace gemm
+}  // namespace s21
+
+#endif  // S21_GEMM_H
@@ -0,0 +1,118 @@
+#include "s21_instrumentation.h"
+
+#include <atomic>
+
+namespace s21::instrumentation {
+
+namespace {
+
+std::atomic<std::uint64_t> counters[kCounterCount];
+std::atomic<std::uint64_t> calls[kOperationCount];
+std::atomic<std::uint64_t> flops[kOperationCount];
+std::atomic<std::uint64_t> nanoseconds[kOperationCount];
+
+// Глубина вложенности учитываемых операций в текущем потоке
+thread_local int depth = 0;
+
+void Add(std::atomic<std::uint64_t>& counter, std::uint64_t value) noexcept {
+  counter.fetch_add(value, std::memory_order_relaxed);
+}
+
+std::uint64_t Load(const std::atomic<std::uint64_t>& counter) noexcept {
+  return counter.load(std::memory_order_relaxed);
+}
+
+}  // namespace
+
+std::uint64_t Snapshot::flops() const noexcept {
+  std::uint64_t total = 0;
+  for (const OperationStats& stats : operations) total += stats.flops;
+  return total;
+}
+
+bool Enabled() noexcept {
+#ifdef S21_MATRIX_INSTRUMENTATION
+  return true;
+#else
+  return false;
+#endif
+}
+
+Snapshot TakeSnapshot() noexcept {
+  Snapshot snapshot;
+  for (int i = 0; i < kCounterCount; ++i)
+    snapshot.counters[i] = Load(counters[i]);
+  for (int i = 0; i < kOperationCount; ++i) {
+    snapshot.operations[i].calls = Load(calls[i]);
+    snapshot.operations[i].flops = Load(flops[i]);
+    snapshot.operations[i].nanoseconds = Load(nanoseconds[i]);
+  }
+  return snapshot;
+}
+
+void Reset() noexcept {
+  for (auto& counter : counters) counter.store(0, std::memory_order_relaxed);
+  for (int i = 0; i < kOperationCount; ++i) {
+    calls[i].store(0, std::memory_order_relaxed);
+    flops[i].store(0, std::memory_order_relaxed);
+    nanoseconds[i].store(0, std::memory_order_relaxed);
+  }
+}
+
+const char* Name(Counter counter) noexcept {
+  static const char* const kNames[kCounterCount] = {
+      "allocations", "allocated_bytes", "deep_copies", "bytes_copied",
+      "moves"};
+  return kNames[static_cast<int>(counter)];
+}
+
+const char* Name(Operation operation) noexcept {
+  static const char* const kNames[kOperationCount] = {
+      "EqMatrix",    "SumMatrix",       "SubMatrix",     "MulNumber",
+      "MulMatrix",   "MulAddMatrix",    "Transpose",     "TransposeInPlace",
+      "Determinant", "CalcComplements", "InverseMatrix", "Gemm",
+      "Gemv",        "Axpy",            "Scal"};
+  return kNames[static_cast<int>(operation)];
+}
+
+// Плоский объект: счётчики памяти, сумма FLOP и объект operations с
+// calls, flops и nanoseconds каждой операции
+void WriteJson(std::ostream& out, const Snapshot& snapshot) {
+  out << "{\n  \"enabled\": " << (Enabled() ? "true" : "false");
+  for (int i = 0; i < kCounterCount; ++i) {
+    out << ",\n  \"" << Name(static_cast<Counter>(i))
+        << "\": " << snapshot.counters[i];
+  }
+  out << ",\n  \"flops\": " << snapshot.flops() << ",\n  \"operations\": {";
+  for (int i = 0; i < kOperationCount; ++i) {
+    const OperationStats& stats = snapshot.operations[i];
+    out << (i ? ",\n" : "\n") << "    \"" << Name(static_cast<Operation>(i))
+        << "\": {\"calls\": " << stats.calls << ", \"flops\": " << stats.flops
+        << ", \"nanoseconds\": " << stats.nanoseconds << '}';
+  }
+  out << "\n  }\n}\n";
+}
+
+void detail::Add(Counter counter, std::uint64_t value) noexcept {
+  instrumentation::Add(counters[static_cast<int>(counter)], value);
+}
+
+ScopedOperation::ScopedOperation(Operation operation,
+                                 std::uint64_t flops) noexcept
+    : operation_(operation), flops_(flops), outermost_(depth++ == 0) {
+  if (outermost_) start_ = std::chrono::steady_clock::now();
+}
+
+ScopedOperation::~ScopedOperation() {
+  --depth;
+  if (!outermost_) return;
+
+  const auto elapsed = std::chrono::steady_clock::now() - start_;
+  const int i = static_cast<int>(operation_);
+  Add(calls[i], 1);
+  Add(flops[i], flops_);
+  Add(nanoseconds[i],
+      std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+}  // namespace s21::instrumentation
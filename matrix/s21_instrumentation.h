@@ -0,0 +1,116 @@
+#ifndef S21_INSTRUMENTATION_H
+#define S21_INSTRUMENTATION_H
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+// Счётчики выделений памяти, копирований, перемещений и операций над
+// матрицами. Включаются при сборке библиотеки флагом
+// -DS21_MATRIX_INSTRUMENTATION (make INSTRUMENT=1); без него макросы ниже
+// ничего не вычисляют, а снимок остаётся нулевым.
+//
+// Операция учитывается только на внешнем уровне вызовов потока: время и
+// FLOP вложенных вызовов (MulAddMatrix внутри MulMatrix, определители
+// миноров внутри CalcComplements) входят во внешнюю операцию, поэтому
+// суммы по операциям не учитывают одну работу дважды. FLOP — номинальное
+// количество арифметических операций алгоритма, а не счёт инструкций
+namespace s21::instrumentation {
+
+// Счётчики памяти
+enum class Counter {
+  kAllocations,     // Выделенных буферов матриц
+  kAllocatedBytes,  // Байт в выделенных буферах
+  kDeepCopies,      // Копирований буфера
+  kBytesCopied,     // Скопированных байт
+  kMoves,           // Перемещений без копирования
+  kCount
+};
+
+// Учитываемые операции
+enum class Operation {
+  kEqMatrix,
+  kSumMatrix,
+  kSubMatrix,
+  kMulNumber,
+  kMulMatrix,  // MulMatrix и operator*
+  kMulAddMatrix,
+  kTranspose,
+  kTransposeInPlace,
+  kDeterminant,
+  kCalcComplements,
+  kInverseMatrix,
+  kGemm,  // Функции s21::blas
+  kGemv,
+  kAxpy,
+  kScal,
+  kCount
+};
+
+constexpr int kCounterCount = static_cast<int>(Counter::kCount);
+constexpr int kOperationCount = static_cast<int>(Operation::kCount);
+
+struct OperationStats {
+  std::uint64_t calls = 0;
+  std::uint64_t flops = 0;
+  std::uint64_t nanoseconds = 0;  // Время внешних вызовов
+};
+
+// Значения счётчиков на момент снимка. Счётчики читаются по одному, поэтому
+// при работе других потоков снимок может быть несогласованным
+struct Snapshot {
+  std::uint64_t counters[kCounterCount] = {};
+  OperationStats operations[kOperationCount] = {};
+
+  std::uint64_t operator[](Counter counter) const noexcept {
+    return counters[static_cast<int>(counter)];
+  }
+  const OperationStats& operator[](Operation operation) const noexcept {
+    return operations[static_cast<int>(operation)];
+  }
+  std::uint64_t flops() const noexcept;  // FLOP всех операций
+};
+
+bool Enabled() noexcept;  // Собрана ли библиотека с инструментацией
+Snapshot TakeSnapshot() noexcept;  // Текущие значения счётчиков
+void Reset() noexcept;  // Обнуление всех счётчиков
+const char* Name(Counter counter) noexcept;
+const char* Name(Operation operation) noexcept;
+void WriteJson(std::ostream& out,
+               const Snapshot& snapshot);  // Снимок в формате JSON
+
+namespace detail {
+void Add(Counter counter, std::uint64_t value) noexcept;
+}  // namespace detail
+
+// Учёт вызова операции: время от создания до уничтожения объекта и
+// номинальные FLOP, если вызов внешний для потока
+class ScopedOperation {
+ public:
+  ScopedOperation(Operation operation, std::uint64_t flops) noexcept;
+  ScopedOperation(const ScopedOperation&) = delete;
+  ScopedOperation& operator=(const ScopedOperation&) = delete;
+  ~ScopedOperation();
+
+ private:
+  Operation operation_;
+  std::uint64_t flops_;
+  bool outermost_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace s21::instrumentation
+
+#ifdef S21_MATRIX_INSTRUMENTATION
+#define S21_COUNT(counter, value)                      \
+  ::s21::instrumentation::detail::Add(                 \
+      ::s21::instrumentation::Counter::counter, value)
+#define S21_OPERATION(operation, flops)                       \
+  const ::s21::instrumentation::ScopedOperation s21Operation( \
+      ::s21::instrumentation::Operation::operation, flops)
+#else
+#define S21_COUNT(counter, value) static_cast<void>(0)
+#define S21_OPERATION(operation, flops) static_cast<void>(0)
+#endif
+
+#endif  // S21_INSTRUMENTATION_H
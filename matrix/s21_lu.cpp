@@ -0,0 +1,183 @@
+#include "s21_lu.h"
+
+#include <cmath>
+
+#include "s21_gemm.h"
+#include "s21_simd.h"
+#include "s21_thread_pool.h"
+
+namespace s21 {
+
+// Разложение матрицы a
+template <class T>
+LU<T>::LU(const Matrix<T>& a, std::pmr::memory_resource* resource)
+    : lu_(a, resource), pivots_(a.getRows(), resource) {
+  if (a.getRows() != a.getCols())
+    throw std::invalid_argument(
+        "The matrix is not square");  // Проверка на квадратность матрицы
+
+  factorize();
+}
+
+// Блочное правостороннее разложение: панель из kBlock столбцов
+// раскладывается построчными обновлениями, затем вычисляется блочная строка
+// U12 и хвостовая подматрица обновляется одним вызовом GEMM. Обе операции
+// после панели распределяются по пулу потоков
+template <class T>
+void LU<T>::factorize() {
+  const int n = lu_.getRows();
+  const std::ptrdiff_t ld = lu_.stride();
+  T* a = lu_.data();
+  const auto& simd = simd::Active<T>();
+  auto& pool = S21ThreadPool::instance();
+
+  using Real = RealOf<T>;
+
+  for (int k = 0; k < n; k += kBlock) {
+    const int kb = std::min(kBlock, n - k);
+    const int kEnd = k + kb;
+
+    // Разложение панели со столбцами [k, kEnd)
+    for (int j = k; j < kEnd; ++j) {
+      int p = j;
+      Real best = std::abs(a[j * ld + j]);
+      for (int i = j + 1; i < n; ++i) {
+        if (std::abs(a[i * ld + j]) > best) {
+          best = std::abs(a[i * ld + j]);
+          p = i;
+        }
+      }
+      pivots_[j] = p;
+      if (p != j) {
+        // Строки хранятся непрерывно, поэтому перестановка затрагивает сразу
+        // и множители L слева, и ещё не обработанные столбцы справа
+        std::swap_ranges(a + j * ld, a + j * ld + n, a + p * ld);
+        sign_ = -sign_;
+      }
+      // Вырожденной матрица считается только при точно нулевом ведущем
+      // элементе, как в LAPACK getrf: любой относительный порог объявляет
+      // вырожденными обратимые матрицы с большим разбросом масштабов
+      if (best == Real(0)) {
+        singular_ = true;
+        continue;
+      }
+
+      const T* rowJ = a + j * ld;
+      const T inv = T(1) / rowJ[j];
+      for (int i = j + 1; i < n; ++i) {
+        T* rowI = a + i * ld;
+        const T l = (rowI[j] *= inv);
+        for (int c = j + 1; c < kEnd; ++c) rowI[c] -= l * rowJ[c];
+      }
+    }
+
+    if (kEnd == n) break;
+
+    // U12 = L11^-1 * A12, столбцы блочной строки обрабатываются независимо
+    pool.parallelFor(n - kEnd, kColumnGrain, [&](int begin, int end) {
+      for (int i = k + 1; i < kEnd; ++i) {
+        for (int r = k; r < i; ++r) {
+          simd.axpy(a + i * ld + kEnd + begin, -a[i * ld + r],
+                    a + r * ld + kEnd + begin, end - begin);
+        }
+      }
+    });
+
+    // A22 -= L21 * U12
+    gemm::MulAdd(n - kEnd, n - kEnd, kb, T(-1), a + kEnd * ld + k, ld, 1,
+                 a + k * ld + kEnd, ld, 1, a + kEnd * ld + kEnd, ld);
+  }
+}
+
+// Вырождена ли матрица
+template <class T>
+bool LU<T>::isSingular() const noexcept { return singular_; }
+
+// Определитель равен произведению диагонали U с учётом чётности
+// перестановки; у вырожденной матрицы на диагонали есть точный ноль
+template <class T>
+T LU<T>::determinant() const noexcept {
+  T result = T(sign_);
+  for (int i = 0; i < lu_.getRows(); ++i) {
+    result *= lu_.data()[i * lu_.stride() + i];
+  }
+  return result;
+}
+
+// Решение системы A * X = B для всех столбцов B сразу
+template <class T>
+Matrix<T> LU<T>::solve(const Matrix<T>& b,
+                       std::pmr::memory_resource* resource) const {
+  if (b.getRows() != lu_.getRows())
+    throw std::invalid_argument(
+        "The number of rows in the right-hand side does not match the "
+        "matrix");  // Проверка на соответствие размеров
+  if (singular_)
+    throw std::invalid_argument(
+        "Matrix determinant is 0");  // Проверка на вырожденность
+
+  Matrix<T> x(b, resource);
+  const std::ptrdiff_t ld = x.stride();
+  T* data = x.data();
+  for (int k = 0; k < lu_.getRows(); ++k) {
+    if (pivots_[k] != k) {
+      std::swap_ranges(data + k * ld, data + k * ld + x.getCols(),
+                       data + pivots_[k] * ld);
+    }
+  }
+
+  substitute(x, false);
+  return x;
+}
+
+// Обратная матрица A^-1 = U^-1 * L^-1 * P. Перестановка применяется к
+// столбцам в конце, поэтому прямая подстановка идёт по единичной матрице и
+// может пропускать заведомо нулевые столбцы над диагональю
+template <class T>
+Matrix<T> LU<T>::inverse(std::pmr::memory_resource* resource) const {
+  if (singular_)
+    throw std::invalid_argument(
+        "Matrix determinant is 0");  // Проверка на вырожденность
+
+  const int n = lu_.getRows();
+  Matrix<T> x(n, n, resource);
+  const std::ptrdiff_t ld = x.stride();
+  T* data = x.data();
+  for (int i = 0; i < n; ++i) data[i * ld + i] = T(1);
+
+  substitute(x, true);
+
+  for (int k = n - 1; k >= 0; --k) {
+    if (pivots_[k] == k) continue;
+    for (int i = 0; i < n; ++i) {
+      std::swap(data[i * ld + k], data[i * ld + pivots_[k]]);
+    }
+  }
+  return x;
+}
+
+// Множители L под диагональю и U на диагонали и выше
+template <class T>
+const Matrix<T>& LU<T>::packed() const noexcept { return lu_; }
+
+// Перестановки строк в порядке применения
+template <class T>
+const std::pmr::vector<int>& LU<T>::pivots() const noexcept {
+  return pivots_;
+}
+
+// Прямая подстановка с единичной диагональю L и обратная с U
+template <class T>
+void LU<T>::substitute(Matrix<T>& x, bool lowerRhs) const {
+  const int n = lu_.getRows();
+  triangular::SolveLower(n, x.getCols(), lu_.data(), lu_.stride(), true,
+                         x.data(), x.stride(), lowerRhs);
+  triangular::SolveUpper(n, x.getCols(), lu_.data(), lu_.stride(), x.data(),
+                         x.stride());
+}
+
+#define S21_INSTANTIATE(T) template class LU<T>;
+S21_MATRIX_ELEMENT_TYPES(S21_INSTANTIATE)
+#undef S21_INSTANTIATE
+
+}  // namespace s21
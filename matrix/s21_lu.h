@@ -0,0 +1,58 @@
+#ifndef S21_LU_H
+#define S21_LU_H
+
+#include <memory_resource>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+#include "s21_triangular.h"
+
+namespace s21 {
+
+// LU-разложение квадратной матрицы с частичным выбором ведущего элемента:
+// P * A = L * U. Разложение выполняется один раз в конструкторе, после чего
+// его можно многократно использовать для решения систем и обращения.
+// Ведущий элемент выбирается по модулю, в том числе для комплексных матриц
+template <class T>
+class LU {
+ public:
+  // Размер блока столбцов для блочного разложения и блочных подстановок
+  static constexpr int kBlock = triangular::kBlock;
+  // Ширина полосы столбцов для одной задачи пула потоков
+  static constexpr int kColumnGrain = triangular::kColumnGrain;
+
+  explicit LU(const Matrix<T>& a,
+              std::pmr::memory_resource* resource =
+                  std::pmr::get_default_resource());  // Разложение матрицы a
+
+  bool isSingular() const noexcept;  // Вырождена ли матрица
+  T determinant() const noexcept;  // Определитель исходной матрицы
+  Matrix<T> solve(const Matrix<T>& b,
+                  std::pmr::memory_resource* resource =
+                      std::pmr::get_default_resource())
+      const;  // Решение A * X = B
+  Matrix<T> inverse(std::pmr::memory_resource* resource =
+                        std::pmr::get_default_resource())
+      const;  // Обратная матрица
+
+  const Matrix<T>& packed()
+      const noexcept;  // L (без диагонали) и U в одной матрице
+  const std::pmr::vector<int>& pivots() const noexcept;  // Перестановки строк
+
+ private:
+  void factorize();  // Блочное разложение на месте
+  void substitute(Matrix<T>& x,
+                  bool lowerRhs) const;  // Решение L * U * X = X на месте
+
+  Matrix<T> lu_;  // Множители L под диагональю, U на диагонали и выше
+  std::pmr::vector<int>
+      pivots_;  // Строка k была переставлена со строкой pivots_[k]
+  int sign_ = 1;             // Чётность перестановки
+  bool singular_ = false;    // Найден нулевой ведущий элемент
+};
+
+}  // namespace s21
+
+using S21LU = s21::LU<double>;
+
+#endif  // S21_LU_H
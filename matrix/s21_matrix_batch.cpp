@@ -0,0 +1,389 @@
+#include "s21_matrix_batch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstring>
+#include <new>
+
+#include "s21_scratch_arena.h"
+#include "s21_thread_pool.h"
+
+namespace s21 {
+
+namespace {
+
+// Векторные версии ядер выбираются загрузчиком по CPUID (кроме сборки с
+// ThreadSanitizer, который не переносит ifunc-резолверы)
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && \
+    !defined(__SANITIZE_THREAD__)
+#define S21_BATCH_CLONES \
+  __attribute__((target_clones("avx512f", "avx2,fma", "default")))
+#else
+#define S21_BATCH_CLONES
+#endif
+
+// Во всех ядрах внутренний цикл идёт по L матрицам пачки: элемент (i, j)
+// матрицы l пачки лежит в x[(i * cols + j) * L + l]
+
+// C = A * B для пачки: A n x k, B k x m, C n x m. Столбцы C считаются по
+// kColumns сразу: независимые накопители скрывают задержку FMA
+template <class T, int L>
+S21_BATCH_CLONES void MulBlock(int n, int k, int m, const T* a, const T* b,
+                               T* c) {
+  constexpr int kColumns = 4;
+  for (int i = 0; i < n; ++i) {
+    const T* rowA = a + i * k * L;
+    T* rowC = c + i * m * L;
+    int j = 0;
+    for (; j + kColumns <= m; j += kColumns) {
+      T acc[kColumns][L] = {};
+      for (int p = 0; p < k; ++p) {
+        const T* bp = b + (p * m + j) * L;
+        for (int q = 0; q < kColumns; ++q) {
+          for (int l = 0; l < L; ++l)
+            acc[q][l] += rowA[p * L + l] * bp[q * L + l];
+        }
+      }
+      std::copy(acc[0], acc[0] + kColumns * L, rowC + j * L);
+    }
+    for (; j < m; ++j) {
+      T acc[L] = {};
+      for (int p = 0; p < k; ++p) {
+        const T* bp = b + (p * m + j) * L;
+        for (int l = 0; l < L; ++l) acc[l] += rowA[p * L + l] * bp[l];
+      }
+      std::copy(acc, acc + L, rowC + j * L);
+    }
+  }
+}
+
+// Метод Гаусса с частичным выбором ведущего элемента для пачки: A n x n
+// приводится к верхнетреугольному виду на месте, те же преобразования строк
+// применяются к правым частям B n x m, затем B заменяется решением обратной
+// подстановкой. Ведущий элемент выбирается в каждой матрице отдельно;
+// как и в s21::LU, вырожденной считается матрица с точно нулевым ведущим
+// элементом. Для неё singular[l] = 1, а её решение не определено
+template <class T, int L>
+S21_BATCH_CLONES void SolveBlock(int n, int m, T* a, T* b, T* inverseDiag,
+                                 T* determinant, unsigned char* singular) {
+  using Real = RealOf<T>;
+  T det[L];
+  for (int l = 0; l < L; ++l) {
+    det[l] = T(1);
+    singular[l] = 0;
+  }
+
+  for (int k = 0; k < n; ++k) {
+    int pivot[L];
+    Real best[L];
+    for (int l = 0; l < L; ++l) {
+      pivot[l] = k;
+      best[l] = std::abs(a[(k * n + k) * L + l]);
+    }
+    for (int i = k + 1; i < n; ++i) {
+      for (int l = 0; l < L; ++l) {
+        const Real v = std::abs(a[(i * n + k) * L + l]);
+        pivot[l] = v > best[l] ? i : pivot[l];
+        best[l] = v > best[l] ? v : best[l];
+      }
+    }
+    // Перестановки в разных матрицах пачки различаются, поэтому строки
+    // меняются поэлементно
+    for (int l = 0; l < L; ++l) {
+      const int p = pivot[l];
+      if (p == k) continue;
+      for (int j = k; j < n; ++j)
+        std::swap(a[(k * n + j) * L + l], a[(p * n + j) * L + l]);
+      for (int j = 0; j < m; ++j)
+        std::swap(b[(k * m + j) * L + l], b[(p * m + j) * L + l]);
+      det[l] = -det[l];
+    }
+
+    T* inv = inverseDiag + k * L;
+    const T* rowK = a + k * n * L;
+    for (int l = 0; l < L; ++l) {
+      const bool zero = !(best[l] > Real(0));
+      singular[l] |= zero;
+      det[l] *= rowK[k * L + l];
+      inv[l] = zero ? T() : T(1) / rowK[k * L + l];
+    }
+    for (int i = k + 1; i < n; ++i) {
+      T* rowI = a + i * n * L;
+      T f[L];
+      for (int l = 0; l < L; ++l) f[l] = rowI[k * L + l] * inv[l];
+      for (int j = k + 1; j < n; ++j) {
+        for (int l = 0; l < L; ++l) rowI[j * L + l] -= f[l] * rowK[j * L + l];
+      }
+      T* bI = b + i * m * L;
+      const T* bK = b + k * m * L;
+      for (int j = 0; j < m; ++j) {
+        for (int l = 0; l < L; ++l) bI[j * L + l] -= f[l] * bK[j * L + l];
+      }
+    }
+  }
+
+  for (int k = n - 1; k >= 0; --k) {
+    const T* rowK = a + k * n * L;
+    for (int j = 0; j < m; ++j) {
+      T x[L];
+      std::copy(b + (k * m + j) * L, b + (k * m + j + 1) * L, x);
+      for (int c = k + 1; c < n; ++c) {
+        const T* bC = b + (c * m + j) * L;
+        for (int l = 0; l < L; ++l) x[l] -= rowK[c * L + l] * bC[l];
+      }
+      for (int l = 0; l < L; ++l)
+        b[(k * m + j) * L + l] = x[l] * inverseDiag[k * L + l];
+    }
+  }
+
+  if (determinant) {
+    for (int l = 0; l < L; ++l) determinant[l] = singular[l] ? T() : det[l];
+  }
+}
+
+}  // namespace
+
+// Набор из count нулевых матриц
+template <class T>
+MatrixBatch<T>::MatrixBatch(int count, int rows, int cols)
+    : MatrixBatch(count, rows, cols, Uninitialized{}) {
+  std::fill(data_, data_ + blockSize() * blocks(), T());
+}
+
+// Конструктор для результатов, все элементы которых будут перезаписаны
+template <class T>
+MatrixBatch<T>::MatrixBatch(int count, int rows, int cols, Uninitialized)
+    : count_(count), rows_(rows), cols_(cols) {
+  if (rows <= 0 || cols <= 0) throw std::invalid_argument("Zero matrix");
+  if (count < 0) throw std::invalid_argument("Negative batch size");
+
+  const std::size_t total = blockSize() * blocks();
+  if (total) {
+    data_ = static_cast<T*>(::operator new(
+        sizeof(T) * total, std::align_val_t(Matrix<T>::kAlignment)));
+  }
+}
+
+template <class T>
+MatrixBatch<T>::MatrixBatch(const MatrixBatch& other)
+    : MatrixBatch(other.count_, other.rows_, other.cols_, Uninitialized{}) {
+  if (data_) {
+    std::memcpy(static_cast<void*>(data_), other.data_,
+                sizeof(T) * blockSize() * blocks());
+  }
+}
+
+template <class T>
+MatrixBatch<T>::MatrixBatch(MatrixBatch&& other) noexcept
+    : count_(other.count_),
+      rows_(other.rows_),
+      cols_(other.cols_),
+      data_(other.data_) {
+  other.count_ = 0;
+  other.data_ = nullptr;
+}
+
+template <class T>
+MatrixBatch<T>& MatrixBatch<T>::operator=(const MatrixBatch& other) {
+  if (this != &other) *this = MatrixBatch(other);
+  return *this;
+}
+
+template <class T>
+MatrixBatch<T>& MatrixBatch<T>::operator=(MatrixBatch&& other) noexcept {
+  std::swap(count_, other.count_);
+  std::swap(rows_, other.rows_);
+  std::swap(cols_, other.cols_);
+  std::swap(data_, other.data_);
+  return *this;
+}
+
+template <class T>
+MatrixBatch<T>::~MatrixBatch() {
+  ::operator delete(data_, std::align_val_t(Matrix<T>::kAlignment));
+}
+
+template <class T>
+void MatrixBatch<T>::checkIndex(int k, int i, int j) const {
+  if (k < 0 || k >= count_ || i < 0 || i >= rows_ || j < 0 || j >= cols_)
+    throw std::out_of_range("Index out of range");
+}
+
+// Элемент (i, j) матрицы k
+template <class T>
+T& MatrixBatch<T>::operator()(int k, int i, int j) {
+  checkIndex(k, i, j);
+  return block(k / kLanes)[(i * cols_ + j) * kLanes + k % kLanes];
+}
+
+template <class T>
+const T& MatrixBatch<T>::operator()(int k, int i, int j) const {
+  checkIndex(k, i, j);
+  return block(k / kLanes)[(i * cols_ + j) * kLanes + k % kLanes];
+}
+
+// Копия матрицы k
+template <class T>
+Matrix<T> MatrixBatch<T>::get(int k) const {
+  checkIndex(k, 0, 0);
+  Matrix<T> result(rows_, cols_);
+  const T* src = block(k / kLanes) + k % kLanes;
+  for (int i = 0; i < rows_; ++i) {
+    T* dst = result.data() + static_cast<std::ptrdiff_t>(i) * result.stride();
+    for (int j = 0; j < cols_; ++j) dst[j] = src[(i * cols_ + j) * kLanes];
+  }
+  return result;
+}
+
+// Запись матрицы k
+template <class T>
+void MatrixBatch<T>::set(int k, const Matrix<T>& matrix) {
+  checkIndex(k, 0, 0);
+  if (matrix.getRows() != rows_ || matrix.getCols() != cols_)
+    throw std::invalid_argument("Different matrix dimensions");
+  T* dst = block(k / kLanes) + k % kLanes;
+  for (int i = 0; i < rows_; ++i) {
+    const T* src =
+        matrix.data() + static_cast<std::ptrdiff_t>(i) * matrix.stride();
+    for (int j = 0; j < cols_; ++j) dst[(i * cols_ + j) * kLanes] = src[j];
+  }
+}
+
+// Поэлементное сравнение всех матриц
+template <class T>
+bool MatrixBatch<T>::EqMatrix(const MatrixBatch& other) const {
+  if (count_ != other.count_ || rows_ != other.rows_ || cols_ != other.cols_)
+    return false;
+  for (int k = 0; k < count_; ++k) {
+    const T* a = block(k / kLanes) + k % kLanes;
+    const T* b = other.block(k / kLanes) + k % kLanes;
+    for (int e = 0; e < rows_ * cols_; ++e) {
+      if (!(std::abs(a[e * kLanes] - b[e * kLanes]) <= Matrix<T>::kEpsilon))
+        return false;
+    }
+  }
+  return true;
+}
+
+// Попарное умножение матриц двух наборов
+template <class T>
+void MatrixBatch<T>::MulMatrix(const MatrixBatch& other) {
+  *this = *this * other;
+}
+
+// Определители всех матриц; у вырожденных матриц определитель равен 0
+template <class T>
+std::vector<T> MatrixBatch<T>::Determinant() const {
+  if (rows_ != cols_) throw std::invalid_argument("The matrix is not square");
+
+  std::vector<T> result(count_);
+  S21ThreadPool::instance().forEachRowBlock(
+      blocks(), blockSize(), [&](int begin, int end) {
+        ScratchArena& arena = ScratchArena::local();  // Арена потока задачи
+        std::pmr::vector<T> a(blockSize(), &arena);
+        std::pmr::vector<T> inverseDiag(rows_ * kLanes, &arena);
+        T determinant[kLanes];
+        unsigned char singular[kLanes];
+        for (int b = begin; b < end; ++b) {
+          std::copy(block(b), block(b) + blockSize(), a.data());
+          SolveBlock<T, kLanes>(rows_, 0, a.data(), nullptr,
+                                inverseDiag.data(), determinant, singular);
+          const int lanes = std::min(kLanes, count_ - b * kLanes);
+          std::copy(determinant, determinant + lanes,
+                    result.begin() + b * kLanes);
+        }
+      });
+  return result;
+}
+
+// Решение this[k] * X = x[k] с заменой правых частей решениями; при identity
+// правые части не читаются, а заполняются единичными матрицами в том же
+// проходе. Пустые места последней пачки не проверяются на вырожденность
+template <class T>
+void MatrixBatch<T>::solveInPlace(MatrixBatch& x, bool identity) const {
+  S21ThreadPool::instance().forEachRowBlock(
+      blocks(), blockSize() + x.blockSize(), [&](int begin, int end) {
+        ScratchArena& arena = ScratchArena::local();  // Арена потока задачи
+        std::pmr::vector<T> a(blockSize(), &arena);
+        std::pmr::vector<T> inverseDiag(rows_ * kLanes, &arena);
+        unsigned char singular[kLanes];
+        for (int b = begin; b < end; ++b) {
+          std::copy(block(b), block(b) + blockSize(), a.data());
+          if (identity) {
+            std::fill(x.block(b), x.block(b) + x.blockSize(), T());
+            for (int i = 0; i < rows_; ++i)
+              std::fill_n(x.block(b) + (i * rows_ + i) * kLanes, kLanes, T(1));
+          }
+          SolveBlock<T, kLanes>(rows_, x.cols_, a.data(), x.block(b),
+                                inverseDiag.data(), nullptr, singular);
+          const int lanes = std::min(kLanes, count_ - b * kLanes);
+          if (std::any_of(singular, singular + lanes,
+                          [](unsigned char s) { return s != 0; }))
+            throw std::invalid_argument("Matrix determinant is 0");
+        }
+      });
+}
+
+// Обратные матрицы: решение this[k] * X = E для всех k
+template <class T>
+MatrixBatch<T> MatrixBatch<T>::InverseMatrix() const {
+  if (rows_ != cols_) throw std::invalid_argument("The matrix is not square");
+
+  MatrixBatch result(count_, rows_, cols_, Uninitialized{});
+  solveInPlace(result, true);
+  return result;
+}
+
+// Решение систем this[k] * X = rhs[k] для всех столбцов правых частей
+template <class T>
+MatrixBatch<T> MatrixBatch<T>::Solve(const MatrixBatch& rhs) const {
+  if (rows_ != cols_) throw std::invalid_argument("The matrix is not square");
+  if (count_ != rhs.count_)
+    throw std::invalid_argument("Different batch sizes");
+  if (rhs.rows_ != rows_)
+    throw std::invalid_argument(
+        "The number of rows in the right-hand side does not match the "
+        "matrix");
+
+  MatrixBatch result(rhs);
+  solveInPlace(result, false);
+  return result;
+}
+
+template <class T>
+MatrixBatch<T> MatrixBatch<T>::operator*(const MatrixBatch& other) const {
+  if (count_ != other.count_)
+    throw std::invalid_argument("Different batch sizes");
+  if (cols_ != other.rows_)
+    throw std::invalid_argument(
+        "The number of columns in the first matrix is not equal to the rows in "
+        "second matrix");
+
+  MatrixBatch result(count_, rows_, other.cols_, Uninitialized{});
+  S21ThreadPool::instance().forEachRowBlock(
+      blocks(), blockSize(), [&](int begin, int end) {
+        for (int b = begin; b < end; ++b) {
+          MulBlock<T, kLanes>(rows_, cols_, other.cols_, block(b),
+                              other.block(b), result.block(b));
+        }
+      });
+  return result;
+}
+
+template <class T>
+MatrixBatch<T>& MatrixBatch<T>::operator*=(const MatrixBatch& other) {
+  MulMatrix(other);
+  return *this;
+}
+
+template <class T>
+bool MatrixBatch<T>::operator==(const MatrixBatch& other) const {
+  return EqMatrix(other);
+}
+
+#define S21_INSTANTIATE(T) template class MatrixBatch<T>;
+S21_MATRIX_ELEMENT_TYPES(S21_INSTANTIATE)
+#undef S21_INSTANTIATE
+
+}  // namespace s21
@@ -0,0 +1,80 @@
+#ifndef S21_MATRIX_BATCH_H
+#define S21_MATRIX_BATCH_H
+
+#include <cstddef>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+namespace s21 {
+
+// Набор из size() независимых матриц rows x cols одного размера, например
+// тысяч матриц 3x3 - 16x16. Матрицы хранятся пачками по kLanes: элемент
+// (i, j) всех матриц пачки лежит подряд, поэтому операции обрабатывают
+// kLanes матриц одной векторной инструкцией, а пачки распределяются между
+// потоками пула. Инстанцирован для типов S21_MATRIX_ELEMENT_TYPES
+template <class T>
+class MatrixBatch {
+ public:
+  using value_type = T;
+  using Real = RealOf<T>;
+
+  // Матриц в пачке: одна строка кэша на каждый элемент
+  static constexpr int kLanes =
+      static_cast<int>(Matrix<T>::kAlignment / sizeof(T));
+
+  // Конструкторы и деструктор
+  MatrixBatch(int count, int rows, int cols);  // count нулевых матриц
+  MatrixBatch(const MatrixBatch& other);
+  MatrixBatch(MatrixBatch&& other) noexcept;
+  MatrixBatch& operator=(const MatrixBatch& other);
+  MatrixBatch& operator=(MatrixBatch&& other) noexcept;
+  ~MatrixBatch();
+
+  // Размеры
+  int size() const noexcept { return count_; }
+  int getRows() const noexcept { return rows_; }
+  int getCols() const noexcept { return cols_; }
+
+  // Доступ к элементам и обмен с отдельными матрицами
+  T& operator()(int k, int i, int j);  // Элемент (i, j) матрицы k
+  const T& operator()(int k, int i, int j) const;
+  Matrix<T> get(int k) const;  // Копия матрицы k
+  void set(int k, const Matrix<T>& matrix);  // Запись матрицы k
+
+  // Операции над всеми матрицами набора
+  bool EqMatrix(const MatrixBatch& other) const;  // С точностью kEpsilon
+  void MulMatrix(const MatrixBatch& other);  // this[k] = this[k] * other[k]
+  std::vector<T> Determinant() const;  // Определители всех матриц
+  MatrixBatch InverseMatrix() const;  // Обратные матрицы
+  MatrixBatch Solve(const MatrixBatch& rhs) const;  // X[k]: this[k] * X = B[k]
+
+  // Операторы
+  MatrixBatch operator*(const MatrixBatch& other) const;
+  MatrixBatch& operator*=(const MatrixBatch& other);
+  bool operator==(const MatrixBatch& other) const;
+
+ private:
+  std::size_t blockSize() const noexcept {
+    return static_cast<std::size_t>(rows_) * cols_ * kLanes;
+  }  // Элементов в одной пачке
+  int blocks() const noexcept { return (count_ + kLanes - 1) / kLanes; }
+  T* block(int b) const noexcept { return data_ + b * blockSize(); }
+  struct Uninitialized {};
+  MatrixBatch(int count, int rows, int cols,
+              Uninitialized);  // Конструктор без обнуления элементов
+  void checkIndex(int k, int i, int j) const;
+  void solveInPlace(MatrixBatch& x,
+                    bool identity) const;  // Замена правых частей решениями
+
+  int count_ = 0;  // Количество матриц
+  int rows_ = 0;
+  int cols_ = 0;
+  T* data_ = nullptr;  // blocks() пачек, выровненных по kAlignment
+};
+
+}  // namespace s21
+
+using S21MatrixBatch = s21::MatrixBatch<double>;
+
+#endif  // S21_MATRIX_BATCH_H
@@ -0,0 +1,427 @@
+#ifndef S21_MATRIX_EXPR_H
+#define S21_MATRIX_EXPR_H
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "s21_matrix_oop.h"
+#include "s21_thread_pool.h"
+
+// Ленивые выражения над s21::Matrix. Операторы +, - и умножение на число
+// строят дерево выражения без вычислений; вся цепочка вычисляется одним
+// проходом при присваивании или преобразовании в матрицу. Каждый узел
+// выдаёт по номеру строки объект row(i), индексируемый номером столбца,
+// reusable() — перемещённую в выражение матрицу, буфер которой может принять
+// результат вместо нового выделения памяти, а aliases() — признак того, что
+// запись результата в заданную область испортит ещё не прочитанные операнды
+namespace s21 {
+namespace expr {
+
+// Область памяти, занимаемая матрицей или представлением: элемент (i, j)
+// лежит в data[i * rowStride + j * colStride], шаги неотрицательны
+template <class T>
+struct Region {
+  const T* data;
+  int rows;
+  int cols;
+  std::ptrdiff_t rowStride;
+  std::ptrdiff_t colStride;
+
+  // Пересечение диапазонов адресов (оценка сверху)
+  bool overlaps(const Region& other) const noexcept {
+    if (rows == 0 || cols == 0 || other.rows == 0 || other.cols == 0)
+      return false;
+    return first() <= other.last() && other.first() <= last();
+  }
+  // Совпадение отображения индексов на память
+  bool sameAs(const Region& other) const noexcept {
+    return data == other.data && rows == other.rows && cols == other.cols &&
+           rowStride == other.rowStride && colStride == other.colStride;
+  }
+  // Поэлементная запись в target портит операнд из этой области, только
+  // если области пересекаются и элементы с одинаковыми индексами различны
+  bool conflictsWith(const Region& target) const noexcept {
+    return overlaps(target) && !sameAs(target);
+  }
+
+ private:
+  std::uintptr_t first() const noexcept {
+    return reinterpret_cast<std::uintptr_t>(data);
+  }
+  std::uintptr_t last() const noexcept {
+    return first() + sizeof(T) * ((rows - 1) * rowStride +
+                                  (cols - 1) * colStride);
+  }
+};
+
+template <class T>
+Region<T> regionOf(const Matrix<T>& m) {
+  return {m.data(), m.getRows(), m.getCols(), m.stride(), 1};
+}
+
+// Зависимое от параметров ложное условие для static_assert
+template <class...>
+constexpr bool kReadOnly = false;
+
+// Базовый класс выражений (CRTP). Выражение только читает операнды:
+// неизменяющие операции s21::Matrix вычисляют его в новую матрицу, а для
+// изменяющих операций (SumMatrix, MulNumber и т. п.) выражение нужно сначала
+// вычислить через eval() или присвоить матрице. Так, после
+// auto r = a + b; переменная r — выражение, и r.MulNumber(2.) не
+// компилируется, а (a + b).eval().MulNumber(2.) и S21Matrix r = a + b —
+// компилируются
+template <class E>
+class Base {
+ public:
+  const E& self() const noexcept { return static_cast<const E&>(*this); }
+  int getRows() const noexcept { return self().getRows(); }
+  int getCols() const noexcept { return self().getCols(); }
+  auto operator()(int i, int j) const {
+    if (i < 0 || i >= getRows() || j < 0 || j >= getCols())
+      throw std::out_of_range("Index out of range");
+    return self().row(i)[j];
+  }  // Значение элемента выражения
+
+  template <class F = E>
+  Matrix<typename F::value_type> eval() const {
+    return Matrix<typename F::value_type>(*this);
+  }  // Вычисление в новую матрицу
+
+  // Операции s21::Matrix над вычисленным выражением
+  template <class F = E>
+  bool EqMatrix(const Matrix<typename F::value_type>& other) const {
+    return eval().EqMatrix(other);
+  }
+  template <class F = E>
+  Matrix<typename F::value_type> Transpose() const {
+    return eval().Transpose();
+  }
+  template <class F = E>
+  Matrix<typename F::value_type> CalcComplements() const {
+    return eval().CalcComplements();
+  }
+  template <class F = E>
+  typename F::value_type Determinant() const {
+    return eval().Determinant();
+  }
+  template <class F = E>
+  Matrix<typename F::value_type> InverseMatrix() const {
+    return eval().InverseMatrix();
+  }
+
+  // Изменяющие операции над выражением: понятная ошибка компиляции вместо
+  // «has no member named»
+  template <class... A>
+  void SumMatrix(A&&...) const {
+    static_assert(kReadOnly<A...>, "Expression is read-only: call eval()");
+  }
+  template <class... A>
+  void SubMatrix(A&&...) const {
+    static_assert(kReadOnly<A...>, "Expression is read-only: call eval()");
+  }
+  template <class... A>
+  void MulNumber(A&&...) const {
+    static_assert(kReadOnly<A...>, "Expression is read-only: call eval()");
+  }
+  template <class... A>
+  void MulMatrix(A&&...) const {
+    static_assert(kReadOnly<A...>, "Expression is read-only: call eval()");
+  }
+};
+
+// Ссылка на матрицу-lvalue: живёт не дольше самой матрицы
+template <class T>
+class Ref : public Base<Ref<T>> {
+ public:
+  using value_type = T;
+  explicit Ref(const Matrix<T>& m) noexcept : m_(&m) {}
+  int getRows() const noexcept { return m_->getRows(); }
+  int getCols() const noexcept { return m_->getCols(); }
+  const T* row(int i) const noexcept {
+    return m_->data() + static_cast<std::ptrdiff_t>(i) * m_->stride();
+  }
+  Matrix<T>* reusable() noexcept { return nullptr; }
+  bool aliases(const Region<T>& target) const {
+    return regionOf(*m_).conflictsWith(target);
+  }
+
+ private:
+  const Matrix<T>* m_;
+};
+
+// Временная матрица, перемещённая внутрь выражения: выражение можно хранить
+// дольше полного выражения, в котором оно построено
+template <class T>
+class Owned : public Base<Owned<T>> {
+ public:
+  using value_type = T;
+  explicit Owned(Matrix<T>&& m) noexcept : m_(std::move(m)) {}
+  int getRows() const noexcept { return m_.getRows(); }
+  int getCols() const noexcept { return m_.getCols(); }
+  const T* row(int i) const noexcept {
+    return m_.data() + static_cast<std::ptrdiff_t>(i) * m_.stride();
+  }
+  Matrix<T>* reusable() noexcept { return &m_; }
+  bool aliases(const Region<T>& target) const {
+    return regionOf(m_).conflictsWith(target);
+  }
+
+ private:
+  Matrix<T> m_;
+};
+
+struct Plus {
+  template <class T>
+  static T apply(const T& a, const T& b) noexcept {
+    return a + b;
+  }
+};
+
+struct Minus {
+  template <class T>
+  static T apply(const T& a, const T& b) noexcept {
+    return a - b;
+  }
+};
+
+// Поэлементная операция над двумя выражениями одинакового размера и типа
+// элементов
+template <class Op, class L, class R>
+class Binary : public Base<Binary<Op, L, R>> {
+ public:
+  using value_type = typename L::value_type;
+  static_assert(std::is_same_v<value_type, typename R::value_type>,
+                "Operands must have the same element type");
+
+  Binary(L l, R r) : l_(std::move(l)), r_(std::move(r)) {
+    if (l_.getRows() != r_.getRows() || l_.getCols() != r_.getCols())
+      throw std::invalid_argument("Different matrix dimensions");
+  }
+  int getRows() const noexcept { return l_.getRows(); }
+  int getCols() const noexcept { return l_.getCols(); }
+
+  struct Row {
+    decltype(std::declval<const L&>().row(0)) l;
+    decltype(std::declval<const R&>().row(0)) r;
+    value_type operator[](int j) const noexcept {
+      return Op::apply(value_type(l[j]), value_type(r[j]));
+    }
+  };
+  Row row(int i) const noexcept { return {l_.row(i), r_.row(i)}; }
+  Matrix<value_type>* reusable() noexcept {
+    Matrix<value_type>* m = l_.reusable();
+    return m ? m : r_.reusable();
+  }
+  bool aliases(const Region<value_type>& target) const {
+    return l_.aliases(target) || r_.aliases(target);
+  }
+
+ private:
+  L l_;
+  R r_;
+};
+
+// Выражение, умноженное на число
+template <class E>
+class Scaled : public Base<Scaled<E>> {
+ public:
+  using value_type = typename E::value_type;
+
+  Scaled(E e, value_type num) : e_(std::move(e)), num_(num) {}
+  int getRows() const noexcept { return e_.getRows(); }
+  int getCols() const noexcept { return e_.getCols(); }
+
+  struct Row {
+    decltype(std::declval<const E&>().row(0)) e;
+    value_type num;
+    value_type operator[](int j) const noexcept { return e[j] * num; }
+  };
+  Row row(int i) const noexcept { return {e_.row(i), num_}; }
+  Matrix<value_type>* reusable() noexcept { return e_.reusable(); }
+  bool aliases(const Region<value_type>& target) const {
+    return e_.aliases(target);
+  }
+
+ private:
+  E e_;
+  value_type num_;
+};
+
+template <class T>
+struct IsMatrix : std::false_type {};
+
+template <class T>
+struct IsMatrix<Matrix<T>> : std::true_type {};
+
+// Может ли тип быть операндом выражения: матрица или другое выражение
+template <class T, class D = std::decay_t<T>>
+constexpr bool kIsOperand =
+    IsMatrix<D>::value || std::is_base_of_v<Base<D>, D>;
+
+// Тип элементов операнда
+template <class T>
+using ValueOf = typename std::decay_t<T>::value_type;
+
+// Тип узла, хранящего операнд: lvalue-матрица по ссылке, временная матрица
+// перемещением, выражение копией
+template <class T, class D = std::decay_t<T>, bool = IsMatrix<D>::value>
+struct NodeOf {
+  using type = D;
+};
+
+template <class T, class D>
+struct NodeOf<T, D, true> {
+  using type =
+      std::conditional_t<std::is_lvalue_reference_v<T>,
+                         Ref<typename D::value_type>,
+                         Owned<typename D::value_type>>;
+};
+
+template <class T>
+using Node = typename NodeOf<T>::type;
+
+template <class T>
+Node<T> wrap(T&& operand) {
+  return Node<T>(std::forward<T>(operand));
+}
+
+}  // namespace expr
+}  // namespace s21
+
+// Ленивое сложение матриц и выражений
+template <class L, class R,
+          class = std::enable_if_t<s21::expr::kIsOperand<L> &&
+                                   s21::expr::kIsOperand<R>>>
+s21::expr::Binary<s21::expr::Plus, s21::expr::Node<L>, s21::expr::Node<R>>
+operator+(L&& l, R&& r) {
+  return {s21::expr::wrap(std::forward<L>(l)),
+          s21::expr::wrap(std::forward<R>(r))};
+}
+
+// Ленивое вычитание матриц и выражений
+template <class L, class R,
+          class = std::enable_if_t<s21::expr::kIsOperand<L> &&
+                                   s21::expr::kIsOperand<R>>>
+s21::expr::Binary<s21::expr::Minus, s21::expr::Node<L>, s21::expr::Node<R>>
+operator-(L&& l, R&& r) {
+  return {s21::expr::wrap(std::forward<L>(l)),
+          s21::expr::wrap(std::forward<R>(r))};
+}
+
+// Ленивое умножение матрицы или выражения на число того же типа, что и
+// элементы
+template <class E, class = std::enable_if_t<s21::expr::kIsOperand<E>>>
+s21::expr::Scaled<s21::expr::Node<E>> operator*(
+    E&& e, const s21::expr::ValueOf<E> num) {
+  return {s21::expr::wrap(std::forward<E>(e)), num};
+}
+
+// Матричное умножение выражения вычисляет его перед вызовом GEMM;
+// представления передаются в GEMM без копирования (s21_matrix_view.h)
+template <class E, class T,
+          class = std::enable_if_t<!std::is_same_v<E, s21::MatrixView<T>>>>
+s21::Matrix<T> operator*(const s21::expr::Base<E>& l,
+                         const s21::Matrix<T>& r) {
+  return s21::Matrix<T>(l) * r;
+}
+
+// Сравнение выражения с матрицей
+template <class E, class T>
+bool operator==(const s21::expr::Base<E>& l, const s21::Matrix<T>& r) {
+  return s21::Matrix<T>(l) == r;
+}
+
+namespace s21 {
+
+// Построчное вычисление выражения в уже выделенную матрицу того же размера.
+// Каждый элемент результата зависит только от элементов операндов с теми же
+// индексами, поэтому результат может совпадать с одним из операндов, но не
+// с пересекающимся с ним представлением (вызывающий проверяет aliases)
+template <class T>
+template <class E>
+void Matrix<T>::assignExpr(const E& expr) {
+  static_assert(std::is_same_v<typename E::value_type, T>,
+                "Expression must have the same element type");
+  auto& pool = S21ThreadPool::instance();
+  pool.forEachRowBlock(rows_, stride_, [&](int begin, int end) {
+    for (auto i = begin; i < end; ++i) {
+      T* dst = row(i);
+      const auto src = expr.row(i);
+      for (auto j = 0; j < cols_; ++j) dst[j] = src[j];
+    }
+  });
+}
+
+// Создание матрицы из выражения: одно выделение памяти и один проход
+template <class T>
+template <class E>
+Matrix<T>::Matrix(const expr::Base<E>& expr) {
+  allocateUninitialized(expr.getRows(), expr.getCols());
+  assignExpr(expr.self());
+}
+
+// Создание матрицы из временного выражения. Если в выражение перемещена
+// матрица, результат вычисляется прямо в её буфер и забирается без выделения
+// памяти: поэлементное вычисление допускает совпадение результата с операндом
+template <class T>
+template <class E>
+Matrix<T>::Matrix(expr::Base<E>&& expr) {
+  E& e = static_cast<E&>(expr);
+  Matrix* buffer = e.reusable();
+  if (buffer && !e.aliases(s21::expr::regionOf(*buffer))) {
+    buffer->assignExpr(e);
+    *this = std::move(*buffer);
+  } else {
+    allocateUninitialized(e.getRows(), e.getCols());
+    assignExpr(e);
+  }
+}
+
+// Присваивание выражения: при совпадении размеров без выделения памяти, если
+// выражение не читает пересекающееся с матрицей представление
+template <class T>
+template <class E>
+Matrix<T>& Matrix<T>::operator=(const expr::Base<E>& expr) {
+  if (rows_ == expr.getRows() && cols_ == expr.getCols() &&
+      !expr.self().aliases(s21::expr::regionOf(*this))) {
+    assignExpr(expr.self());
+  } else {
+    Matrix tmp(expr);
+    swap(tmp);
+  }
+  return *this;
+}
+
+// Присваивание временного выражения: при несовпадении размеров результат
+// забирает буфер перемещённой в выражение матрицы, если она есть
+template <class T>
+template <class E>
+Matrix<T>& Matrix<T>::operator=(expr::Base<E>&& expr) {
+  if (rows_ == expr.getRows() && cols_ == expr.getCols() &&
+      !expr.self().aliases(s21::expr::regionOf(*this))) {
+    assignExpr(expr.self());
+  } else {
+    Matrix tmp(std::move(expr));
+    swap(tmp);
+  }
+  return *this;
+}
+
+// Сложение с выражением за один проход
+template <class T>
+template <class E>
+Matrix<T>& Matrix<T>::operator+=(const expr::Base<E>& expr) {
+  return *this = *this + expr.self();
+}
+
+// Вычитание выражения за один проход
+template <class T>
+template <class E>
+Matrix<T>& Matrix<T>::operator-=(const expr::Base<E>& expr) {
+  return *this = *this - expr.self();
+}
+
+}  // namespace s21
+
+#endif  // S21_MATRIX_EXPR_H
@@ -0,0 +1,345 @@
+#include "s21_matrix_io.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <charconv>
+#include <climits>
+#include <vector>
+
+namespace {
+
+constexpr char kMagic[8] = {'S', '2', '1', 'M', 'A', 'T', 'R', 'X'};
+constexpr std::size_t kTextChunk = std::size_t(1) << 16;  // Блок текста
+
+[[noreturn]] void ThrowSystemError(const char* what, const std::string& path) {
+  throw std::runtime_error(std::string(what) + " '" + path +
+                           "': " + std::strerror(errno));
+}
+
+// Дескриптор файла, закрываемый при выходе из области видимости
+class File {
+ public:
+  File(const std::string& path, int flags)
+      : fd_(::open(path.c_str(), flags, 0644)) {
+    if (fd_ < 0) ThrowSystemError("Cannot open matrix file", path);
+  }
+  File(const File&) = delete;
+  File& operator=(const File&) = delete;
+  ~File() { ::close(fd_); }
+  int get() const noexcept { return fd_; }
+
+ private:
+  int fd_;
+};
+
+// Запись всех буферов одним вызовом writev; повтор только при частичной
+// записи, которую ядро допускает для больших объёмов
+void WriteAll(int fd, iovec* parts, int count, const std::string& path) {
+  while (count > 0) {
+    const ssize_t written = ::writev(fd, parts, count);
+    if (written < 0) {
+      if (errno == EINTR) continue;
+      ThrowSystemError("Cannot write matrix file", path);
+    }
+    std::size_t rest = static_cast<std::size_t>(written);
+    while (count > 0 && rest >= parts->iov_len) {
+      rest -= parts->iov_len;
+      ++parts;
+      --count;
+    }
+    if (count > 0) {
+      parts->iov_base = static_cast<char*>(parts->iov_base) + rest;
+      parts->iov_len -= rest;
+    }
+  }
+}
+
+// Чтение ровно size байт с позиции offset
+void ReadAll(int fd, void* dst, std::size_t size, std::uint64_t offset,
+             const std::string& path) {
+  char* p = static_cast<char*>(dst);
+  while (size > 0) {
+    const ssize_t got = ::pread(fd, p, size, static_cast<off_t>(offset));
+    if (got < 0 && errno == EINTR) continue;
+    if (got < 0) ThrowSystemError("Cannot read matrix file", path);
+    if (got == 0) throw std::invalid_argument("Truncated matrix file");
+    p += got;
+    size -= static_cast<std::size_t>(got);
+    offset += static_cast<std::uint64_t>(got);
+  }
+}
+
+// Проверка заголовка и размера файла с элементами типа T
+template <class T>
+void Validate(const S21MatrixFileHeader& header, std::uint64_t fileSize) {
+  if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0)
+    throw std::invalid_argument("Not a matrix file");
+  if (header.byteOrder != S21MatrixFileHeader::kByteOrder)
+    throw std::invalid_argument("Matrix file has a different byte order");
+  if (header.version == 0 || header.version > S21MatrixFileHeader::kVersion)
+    throw std::invalid_argument("Unsupported matrix file version");
+  if (header.dtype != S21MatrixFileHeader::dtypeOf<T>())
+    throw std::invalid_argument("Unsupported matrix element type");
+  if (header.rows == 0 || header.cols == 0 || header.rows > INT_MAX ||
+      header.cols > INT_MAX || header.stride < header.cols)
+    throw std::invalid_argument("Invalid matrix file dimensions");
+  if (header.offset < sizeof(S21MatrixFileHeader) ||
+      header.offset % sizeof(T) != 0 || header.offset > fileSize)
+    throw std::invalid_argument("Invalid matrix file payload offset");
+  const std::uint64_t capacity = (fileSize - header.offset) / sizeof(T);
+  if (capacity / header.rows < header.stride)
+    throw std::invalid_argument("Truncated matrix file");
+}
+
+// Разбор строки текста: числа через пробелы, табуляции, ',' или ';'
+bool IsSeparator(char c) noexcept {
+  return c == ' ' || c == '\t' || c == ',' || c == ';' || c == '\r';
+}
+
+template <class Real>
+int ParseLine(const char* p, const char* end, std::vector<Real>& values) {
+  int count = 0;
+  while (true) {
+    while (p < end && IsSeparator(*p)) ++p;
+    if (p == end) return count;
+    if (*p == '+') ++p;  // from_chars не принимает явный плюс
+    Real value = 0;
+    const auto [next, ec] = std::from_chars(p, end, value);
+    if (ec != std::errc() || (next < end && !IsSeparator(*next)))
+      throw std::invalid_argument("Invalid number in matrix text");
+    values.push_back(value);
+    ++count;
+    p = next;
+  }
+}
+
+}  // namespace
+
+namespace s21 {
+
+// Запись текстом: кратчайшее точное представление чисел через to_chars, не
+// зависящее от локали, и вывод в поток блоками по kTextChunk байт.
+// Комплексный элемент записывается двумя числами: действительной и мнимой
+// частью
+template <class T>
+void Matrix<T>::writeText(std::ostream& out, char separator) const {
+  std::string buffer;
+  buffer.reserve(kTextChunk + 128);
+  char number[64];
+  auto append = [&](Real value) {
+    const auto result = std::to_chars(number, number + sizeof(number), value);
+    buffer.append(number, result.ptr);
+  };
+  for (auto i = 0; i < rows_; ++i) {
+    for (auto j = 0; j < cols_; ++j) {
+      if constexpr (ElementTraits<T>::kComplex) {
+        append(row(i)[j].real());
+        buffer.push_back(separator);
+        append(row(i)[j].imag());
+      } else {
+        append(row(i)[j]);
+      }
+      buffer.push_back(j + 1 < cols_ ? separator : '\n');
+      if (buffer.size() >= kTextChunk) {
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+      }
+    }
+  }
+  out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+  if (!out) throw std::runtime_error("Cannot write matrix text");
+}
+
+// Чтение текста блоками по kTextChunk байт; пустые строки пропускаются, все
+// непустые строки должны содержать одинаковое количество чисел (для
+// комплексных матриц чётное)
+template <class T>
+Matrix<T> Matrix<T>::readText(std::istream& in) {
+  constexpr int kParts = ElementTraits<T>::kComplex ? 2 : 1;
+  std::vector<Real> values;
+  int rows = 0;
+  int cols = 0;
+  auto consumeLine = [&](const char* begin, const char* end) {
+    const int count = ParseLine(begin, end, values);
+    if (count == 0) return;
+    if (count % kParts != 0)
+      throw std::invalid_argument("Incomplete complex number in matrix text");
+    if (rows > 0 && count / kParts != cols)
+      throw std::invalid_argument("Rows of different length in matrix text");
+    cols = count / kParts;
+    ++rows;
+  };
+
+  std::string carry;  // Незавершённая строка предыдущего блока
+  while (in) {
+    const std::size_t size = carry.size();
+    carry.resize(size + kTextChunk);
+    in.read(&carry[size], static_cast<std::streamsize>(kTextChunk));
+    carry.resize(size + static_cast<std::size_t>(in.gcount()));
+
+    std::size_t start = 0;
+    for (auto pos = carry.find('\n', size); pos != std::string::npos;
+         pos = carry.find('\n', pos + 1)) {
+      consumeLine(carry.data() + start, carry.data() + pos);
+      start = pos + 1;
+    }
+    carry.erase(0, start);
+  }
+  consumeLine(carry.data(), carry.data() + carry.size());
+  if (rows == 0) throw std::invalid_argument("Zero matrix");
+
+  Matrix result(rows, cols, Uninitialized{});
+  for (auto i = 0; i < rows; ++i) {
+    const Real* first =
+        values.data() + static_cast<std::ptrdiff_t>(i) * cols * kParts;
+    for (auto j = 0; j < cols; ++j) {
+      if constexpr (ElementTraits<T>::kComplex) {
+        result.row(i)[j] = T(first[2 * j], first[2 * j + 1]);
+      } else {
+        result.row(i)[j] = first[j];
+      }
+    }
+  }
+  return result;
+}
+
+// Сохранение заголовка и всего буфера одним вызовом writev
+template <class T>
+void Matrix<T>::saveBinary(const std::string& path) const {
+  S21MatrixFileHeader header = {};
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = S21MatrixFileHeader::kVersion;
+  header.byteOrder = S21MatrixFileHeader::kByteOrder;
+  header.dtype = S21MatrixFileHeader::dtypeOf<T>();
+  header.alignment = static_cast<std::uint32_t>(kAlignment);
+  header.rows = static_cast<std::uint64_t>(rows_);
+  header.cols = static_cast<std::uint64_t>(cols_);
+  header.stride = static_cast<std::uint64_t>(stride_);
+  header.offset = sizeof(header);
+
+  const File file(path, O_WRONLY | O_CREAT | O_TRUNC);
+  iovec parts[2] = {
+      {&header, sizeof(header)},
+      {matrix_, sizeof(T) * static_cast<std::size_t>(rows_) * stride_}};
+  WriteAll(file.get(), parts, 2, path);
+}
+
+// Чтение файла в новую матрицу: при совпадении шага строк одним чтением,
+// иначе построчно
+template <class T>
+Matrix<T> Matrix<T>::loadBinary(const std::string& path) {
+  const File file(path, O_RDONLY);
+  struct stat info;
+  if (::fstat(file.get(), &info) != 0)
+    ThrowSystemError("Cannot read matrix file", path);
+  const auto fileSize = static_cast<std::uint64_t>(info.st_size);
+  if (fileSize < sizeof(S21MatrixFileHeader))
+    throw std::invalid_argument("Truncated matrix file");
+
+  S21MatrixFileHeader header;
+  ReadAll(file.get(), &header, sizeof(header), 0, path);
+  Validate<T>(header, fileSize);
+
+  Matrix result(static_cast<int>(header.rows), static_cast<int>(header.cols),
+                Uninitialized{});
+  if (header.stride == static_cast<std::uint64_t>(result.stride_)) {
+    ReadAll(file.get(), result.matrix_,
+            sizeof(T) * header.rows * header.stride, header.offset, path);
+  } else {
+    for (auto i = 0; i < result.rows_; ++i) {
+      ReadAll(file.get(), result.row(i), sizeof(T) * header.cols,
+              header.offset + sizeof(T) * header.stride * i, path);
+    }
+  }
+  return result;
+}
+
+// Отображение файла целиком; заголовок проверяется по отображённой памяти
+template <class T>
+MappedMatrix<T>::MappedMatrix(const std::string& path) {
+  const File file(path, O_RDONLY);
+  struct stat info;
+  if (::fstat(file.get(), &info) != 0)
+    ThrowSystemError("Cannot read matrix file", path);
+  const auto fileSize = static_cast<std::uint64_t>(info.st_size);
+  if (fileSize < sizeof(S21MatrixFileHeader))
+    throw std::invalid_argument("Truncated matrix file");
+
+  length_ = static_cast<std::size_t>(fileSize);
+  mapping_ = ::mmap(nullptr, length_, PROT_READ, MAP_PRIVATE, file.get(), 0);
+  if (mapping_ == MAP_FAILED) {
+    mapping_ = nullptr;
+    ThrowSystemError("Cannot map matrix file", path);
+  }
+
+  S21MatrixFileHeader header;
+  std::memcpy(&header, mapping_, sizeof(header));
+  try {
+    Validate<T>(header, fileSize);
+  } catch (...) {
+    unmap();
+    throw;
+  }
+  data_ = reinterpret_cast<const T*>(static_cast<const char*>(mapping_) +
+                                     header.offset);
+  rows_ = static_cast<int>(header.rows);
+  cols_ = static_cast<int>(header.cols);
+  stride_ = static_cast<std::ptrdiff_t>(header.stride);
+}
+
+template <class T>
+MappedMatrix<T>::MappedMatrix(MappedMatrix&& other) noexcept
+    : mapping_(std::exchange(other.mapping_, nullptr)),
+      length_(std::exchange(other.length_, 0)),
+      data_(std::exchange(other.data_, nullptr)),
+      rows_(std::exchange(other.rows_, 0)),
+      cols_(std::exchange(other.cols_, 0)),
+      stride_(std::exchange(other.stride_, 0)) {}
+
+template <class T>
+MappedMatrix<T>& MappedMatrix<T>::operator=(MappedMatrix&& other) noexcept {
+  if (this != &other) {
+    unmap();
+    mapping_ = std::exchange(other.mapping_, nullptr);
+    length_ = std::exchange(other.length_, 0);
+    data_ = std::exchange(other.data_, nullptr);
+    rows_ = std::exchange(other.rows_, 0);
+    cols_ = std::exchange(other.cols_, 0);
+    stride_ = std::exchange(other.stride_, 0);
+  }
+  return *this;
+}
+
+template <class T>
+MappedMatrix<T>::~MappedMatrix() {
+  unmap();
+}
+
+template <class T>
+void MappedMatrix<T>::unmap() noexcept {
+  if (mapping_) ::munmap(mapping_, length_);
+  mapping_ = nullptr;
+}
+
+// Представление отображённых элементов; страницы доступны только для чтения
+template <class T>
+MatrixView<T> MappedMatrix<T>::view() const {
+  if (!data_) throw std::invalid_argument("Matrix file is not mapped");
+  return {const_cast<T*>(data_), rows_, cols_, stride_, 1};
+}
+
+#define S21_INSTANTIATE(T)                                       \
+  template class MappedMatrix<T>;                                \
+  template void Matrix<T>::writeText(std::ostream&, char) const; \
+  template Matrix<T> Matrix<T>::readText(std::istream&);         \
+  template void Matrix<T>::saveBinary(const std::string&) const; \
+  template Matrix<T> Matrix<T>::loadBinary(const std::string&);
+S21_MATRIX_ELEMENT_TYPES(S21_INSTANTIATE)
+#undef S21_INSTANTIATE
+
+}  // namespace s21
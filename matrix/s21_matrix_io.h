@@ -0,0 +1,88 @@
+#ifndef S21_MATRIX_IO_H
+#define S21_MATRIX_IO_H
+
+#include <cstddef>
+#include <complex>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#include "s21_matrix_oop.h"
+
+// Двоичный формат файла матрицы. Заголовок в 64 байта, затем с offset
+// построчно rows строк по stride элементов (хвост строки после cols
+// заполнен нулями). Числа хранятся в порядке байтов записавшей машины,
+// который определяется по полю byteOrder. Payload начинается с адреса,
+// кратного alignment, поэтому отображённый в память файл читается
+// векторными ядрами так же, как буфер s21::Matrix
+struct S21MatrixFileHeader {
+  char magic[8];             // "S21MATRX"
+  std::uint32_t version;     // Версия формата, kVersion
+  std::uint32_t byteOrder;   // 0x01020304 в порядке байтов записавшего
+  std::uint32_t dtype;       // Тип элементов, kFloat64 и другие
+  std::uint32_t alignment;   // Выравнивание payload и строк в байтах
+  std::uint64_t rows;        // Количество строк
+  std::uint64_t cols;        // Количество столбцов
+  std::uint64_t stride;      // Шаг между строками в элементах
+  std::uint64_t offset;      // Смещение payload от начала файла в байтах
+  std::uint8_t reserved[8];  // Нули
+
+  static constexpr std::uint32_t kVersion = 1;
+  static constexpr std::uint32_t kByteOrder = 0x01020304;
+  static constexpr std::uint32_t kFloat64 = 1;
+  static constexpr std::uint32_t kFloat32 = 2;
+  static constexpr std::uint32_t kLongDouble = 3;  // Формат записавшей машины
+  static constexpr std::uint32_t kComplex64 = 4;   // Пары float
+  static constexpr std::uint32_t kComplex128 = 5;  // Пары double
+
+  // Код типа элементов T
+  template <class T>
+  static constexpr std::uint32_t dtypeOf() noexcept {
+    if constexpr (std::is_same_v<T, float>) return kFloat32;
+    if constexpr (std::is_same_v<T, double>) return kFloat64;
+    if constexpr (std::is_same_v<T, long double>) return kLongDouble;
+    if constexpr (std::is_same_v<T, std::complex<float>>) return kComplex64;
+    if constexpr (std::is_same_v<T, std::complex<double>>) return kComplex128;
+    return 0;
+  }
+};
+
+static_assert(sizeof(S21MatrixFileHeader) == 64, "Header must be 64 bytes");
+
+namespace s21 {
+
+// Файл матрицы, отображённый в память только для чтения. Элементы не
+// копируются: страницы подгружаются при первом обращении. Представление
+// действительно, пока жив объект; запись через него вызывает ошибку
+// защиты памяти. Тип элементов файла должен совпадать с T
+template <class T>
+class MappedMatrix {
+ public:
+  explicit MappedMatrix(const std::string& path);
+  MappedMatrix(const MappedMatrix&) = delete;
+  MappedMatrix& operator=(const MappedMatrix&) = delete;
+  MappedMatrix(MappedMatrix&& other) noexcept;
+  MappedMatrix& operator=(MappedMatrix&& other) noexcept;
+  ~MappedMatrix();
+
+  int getRows() const noexcept { return rows_; }
+  int getCols() const noexcept { return cols_; }
+  const T* data() const noexcept { return data_; }
+  MatrixView<T> view() const;  // Представление без копирования
+
+ private:
+  void unmap() noexcept;
+
+  void* mapping_ = nullptr;  // Начало отображения
+  std::size_t length_ = 0;   // Длина отображения в байтах
+  const T* data_ = nullptr;
+  int rows_ = 0;
+  int cols_ = 0;
+  std::ptrdiff_t stride_ = 0;
+};
+
+}  // namespace s21
+
+using S21MappedMatrix = s21::MappedMatrix<double>;
+
+#endif  // S21_MATRIX_IO_H
@@ -1,159 +1,245 @@
 #include "s21_matrix_oop.h"
 
+#include "s21_instrumentation.h"
+
+namespace s21 {
+
 // Конструктор по умолчанию
-S21Matrix::S21Matrix() : rows_(2), cols_(2), matrix_(new double*[rows_]) {
-  // Выделяем память для массива указателей на строки и заполняем его нулями
-  for (auto i = 0; i < rows_; ++i) {
-    matrix_[i] = new double[cols_];
-    std::fill(matrix_[i], matrix_[i] + cols_, 0);
-  }
-}
+template <class T>
+Matrix<T>::Matrix() { allocate(2, 2); }
 
 // Конструктор с заданными размерами матрицы
-S21Matrix::S21Matrix(int rows, int cols) : rows_(rows), cols_(cols) {
+template <class T>
+Matrix<T>::Matrix(int rows, int cols) {
   // Проверка на нулевую матрицу
-  if (rows_ <= 0 || cols_ <= 0) throw std::invalid_argument("Zero matrix");
+  if (rows <= 0 || cols <= 0) throw std::invalid_argument("Zero matrix");
 
-  // Выделяем память для массива указателей на строки и заполняем его нулями
-  matrix_ = new double*[rows_];
-  for (auto i = 0; i < rows_; ++i) {
-    matrix_[i] = new double[cols_];
-    std::fill(matrix_[i], matrix_[i] + cols_, 0);
-  }
+  allocate(rows, cols);
 }
 
-// Конструктор копирования
-S21Matrix::S21Matrix(const S21Matrix& other)
-    : rows_(other.rows_), cols_(other.cols_) {
-  // Проверка на нулевую матрицу
-  if (rows_ <= 0 || cols_ <= 0) throw std::invalid_argument("Zero matrix");
+// Конструктор с буфером из заданного ресурса памяти
+template <class T>
+Matrix<T>::Matrix(int rows, int cols, std::pmr::memory_resource* resource)
+    : resource_(resource) {
+  if (rows <= 0 || cols <= 0) throw std::invalid_argument("Zero matrix");
 
-  // Выделяем память для массива указателей на строки и копируем элементы
-  matrix_ = new double*[rows_];
-  for (auto i = 0; i < rows_; ++i) {
-    matrix_[i] = new double[cols_];
-    std::fill(matrix_[i], matrix_[i] + cols_, 0);
-  }
+  allocate(rows, cols);
+}
 
-  for (auto i = 0; i < rows_; ++i) {
-    for (auto j = 0; j < cols_; ++j) {
-      matrix_[i][j] = other.matrix_[i][j];
-    }
-  }
+// Конструктор для результатов, все элементы которых будут перезаписаны
+template <class T>
+Matrix<T>::Matrix(int rows, int cols, Uninitialized,
+                  std::pmr::memory_resource* resource)
+    : resource_(resource) {
+  if (rows <= 0 || cols <= 0) throw std::invalid_argument("Zero matrix");
+
+  allocateUninitialized(rows, cols);
+}
+
+// Конструктор копирования
+template <class T>
+Matrix<T>::Matrix(const Matrix& other)
+    : Matrix(other, std::pmr::get_default_resource()) {}
+
+// Копия с буфером из заданного ресурса памяти
+template <class T>
+Matrix<T>::Matrix(const Matrix& other, std::pmr::memory_resource* resource)
+    : resource_(resource) {
+  // Проверка на нулевую матрицу
+  if (other.rows_ <= 0 || other.cols_ <= 0)
+    throw std::invalid_argument("Zero matrix");
+
+  // Одно выделение памяти и одно копирование всего буфера
+  allocateUninitialized(other.rows_, other.cols_);
+  const std::size_t bytes =
+      sizeof(T) * static_cast<std::size_t>(rows_) * stride_;
+  std::memcpy(matrix_, other.matrix_, bytes);
+  S21_COUNT(kDeepCopies, 1);
+  S21_COUNT(kBytesCopied, bytes);
 }
 
 // Конструктор перемещения
-S21Matrix::S21Matrix(S21Matrix&& other)
-    : rows_(other.rows_), cols_(other.cols_), matrix_(other.matrix_) {
+template <class T>
+Matrix<T>::Matrix(Matrix&& other) noexcept
+    : rows_(other.rows_),
+      cols_(other.cols_),
+      stride_(other.stride_),
+      matrix_(other.matrix_),
+      resource_(other.resource_) {
   other.rows_ = 0;
   other.cols_ = 0;
+  other.stride_ = 0;
   other.matrix_ = nullptr;
+  S21_COUNT(kMoves, 1);
 }
 
 // Деструктор
-S21Matrix::~S21Matrix() { freeMemory(); }
+template <class T>
+Matrix<T>::~Matrix() { freeMemory(); }
+
+// Выделение непрерывного обнулённого буфера
+template <class T>
+void Matrix<T>::allocate(int rows, int cols) {
+  allocateUninitialized(rows, cols);
+  std::fill(matrix_, matrix_ + static_cast<std::size_t>(rows_) * stride_, T());
+}
 
-// Освобождение памяти
-void S21Matrix::freeMemory() noexcept {
+// Выделение буфера без инициализации элементов. Шаг строки округляется вверх
+// до kAlignment байт, поэтому каждая строка начинается с выровненного адреса;
+// хвост строки обнуляется, чтобы векторные проходы не встречали мусор
+template <class T>
+void Matrix<T>::allocateUninitialized(int rows, int cols) {
+  constexpr int kRowAlign = static_cast<int>(kAlignment / sizeof(T));
+  const int stride = (cols + kRowAlign - 1) / kRowAlign * kRowAlign;
+  const std::size_t count = static_cast<std::size_t>(rows) * stride;
+
+  matrix_ = static_cast<T*>(resource_->allocate(sizeof(T) * count, kAlignment));
+  S21_COUNT(kAllocations, 1);
+  S21_COUNT(kAllocatedBytes, sizeof(T) * count);
+  rows_ = rows;
+  cols_ = cols;
+  stride_ = stride;
   for (auto i = 0; i < rows_; ++i) {
-    delete[] matrix_[i];
+    std::fill(row(i) + cols_, row(i) + stride_, T());
   }
+}
 
-  delete[] matrix_;
+// Освобождение памяти
+template <class T>
+void Matrix<T>::freeMemory() noexcept {
+  if (matrix_) {
+    resource_->deallocate(
+        matrix_, sizeof(T) * static_cast<std::size_t>(rows_) * stride_,
+        kAlignment);
+  }
+  matrix_ = nullptr;
 }
 
 // Вывод матрицы на экран
-void S21Matrix::printMatrix() noexcept {
+template <class T>
+void Matrix<T>::printMatrix() noexcept {
   for (auto i = 0; i < rows_; ++i) {
     for (auto j = 0; j < cols_; ++j) {
-      std::cout << matrix_[i][j] << " ";
+      std::cout << row(i)[j] << " ";
     }
-    std::cout << std::endl;
+    std::cout << '\n';  // Без сброса буфера на каждой строке
   }
+  std::cout.flush();
 }
 
 // Заполнение матрицы значениями из ввода
-void S21Matrix::fillMatrix() noexcept {
+template <class T>
+void Matrix<T>::fillMatrix() noexcept {
   for (auto i = 0; i < rows_; ++i) {
     for (auto j = 0; j < cols_; ++j) {
-      std::cin >> matrix_[i][j];
+      std::cin >> row(i)[j];
     }
   }
 }
 
 // Заполнение матрицы одним значением
-void S21Matrix::fillMatrix(const double val) noexcept {
+template <class T>
+void Matrix<T>::fillMatrix(const T val) noexcept {
   for (auto i = 0; i < rows_; ++i) {
     for (auto j = 0; j < cols_; ++j) {
-      matrix_[i][j] = val;
+      row(i)[j] = val;
     }
   }
 }
 
 // Заполнение матрицы значениями из одномерного массива
-void S21Matrix::fillMatrixArr(const double* arr) noexcept {
+template <class T>
+void Matrix<T>::fillMatrixArr(const T* arr) noexcept {
   for (auto i = 0; i < rows_; ++i) {
     for (auto j = 0; j < cols_; ++j) {
-      matrix_[i][j] = arr[i * cols_ + j];
+      row(i)[j] = arr[i * cols_ + j];
     }
   }
 }
 
 // Обмен содержимым двух матриц
-void S21Matrix::swap(S21Matrix& other) noexcept {
+template <class T>
+void Matrix<T>::swap(Matrix& other) noexcept {
   std::swap(rows_, other.rows_);
   std::swap(cols_, other.cols_);
+  std::swap(stride_, other.stride_);
   std::swap(matrix_, other.matrix_);
+  std::swap(resource_, other.resource_);
 }
 
 // Получение количества строк матрицы
-int S21Matrix::getRows() const { return rows_; }
+template <class T>
+int Matrix<T>::getRows() const { return rows_; }
 
 // Получение количества столбцов матрицы
-int S21Matrix::getCols() const { return cols_; }
+template <class T>
+int Matrix<T>::getCols() const { return cols_; }
 
 // Установка нового количества строк матрицы
-void S21Matrix::setRows(int rows) {
+template <class T>
+void Matrix<T>::setRows(int rows) {
   // Проверка на отрицательное или нулевое количество строк
   if (rows <= 0)
     throw std::invalid_argument("The number of rows must be greater than zero");
   // Создание новой матрицы с заданным количеством строк и заполнение её
   // текущими данными
-  S21Matrix result(rows, cols_);
-  result.fillMatrix(0);
+  Matrix result(rows, cols_, resource_);
   for (int i = 0; i < std::min(rows_, rows); i++) {
-    for (int j = 0; j < cols_; j++) {
-      result.matrix_[i][j] = matrix_[i][j];
-    }
+    std::copy(row(i), row(i) + cols_, result.row(i));
   }
   // Замена текущей матрицы на новую
-  *this = result;
+  *this = std::move(result);
 }
 
 // Установка нового количества столбцов матрицы
-void S21Matrix::setCols(int cols) {
+template <class T>
+void Matrix<T>::setCols(int cols) {
   // Проверка на отрицательное или нулевое количество столбцов
   if (cols <= 0)
     throw std::invalid_argument("The number of cols must be greater than zero");
   // Создание новой матрицы с заданным количеством столбцов и заполнение её
   // текущими данными
-  S21Matrix result(rows_, cols);
-  result.fillMatrix(0);
+  Matrix result(rows_, cols, resource_);
   for (int i = 0; i < rows_; i++) {
-    for (int j = 0; j < std::min(cols_, cols); j++) {
-      result.matrix_[i][j] = matrix_[i][j];
-    }
+    std::copy(row(i), row(i) + std::min(cols_, cols), result.row(i));
   }
   // Замена текущей матрицы на новую
-  *this = result;
+  *this = std::move(result);
 }
 
 // Получение элемента матрицы по индексам
-double& S21Matrix::getElem(int i, int j) const {
+template <class T>
+T& Matrix<T>::getElem(int i, int j) const {
   // Проверка на выход за границы матрицы
   if (i < 0 || i >= rows_ || j < 0 || j >= cols_) {
     throw std::out_of_range("Index out of range");
   }
 
-  return matrix_[i][j];
+  return row(i)[j];
+}
+
+// Указатель на начало буфера
+template <class T>
+T* Matrix<T>::data() noexcept { return matrix_; }
+
+// Ресурс памяти, из которого выделен буфер
+template <class T>
+std::pmr::memory_resource* Matrix<T>::resource() const noexcept {
+  return resource_;
 }
+
+// Указатель на начало буфера
+template <class T>
+const T* Matrix<T>::data() const noexcept { return matrix_; }
+
+// Шаг между строками в элементах
+template <class T>
+int Matrix<T>::stride() const noexcept { return stride_; }
+
+// Явное инстанцирование для поддерживаемых типов элементов; функции-члены из
+// остальных файлов инстанцируются там же, где определены
+#define S21_INSTANTIATE(T) template class Matrix<T>;
+S21_MATRIX_ELEMENT_TYPES(S21_INSTANTIATE)
+#undef S21_INSTANTIATE
+
+}  // namespace s21
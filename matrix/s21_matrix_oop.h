@@ -4,74 +4,184 @@
 #include <math.h>
 
 #include <algorithm>
+#include <cstddef>
+#include <cstring>
 #include <iostream>
 #include <iterator>
+#include <memory_resource>
+#include <new>
 #include <stdexcept>
+#include <string>
+#include <utility>
 
-#define EPS 1e-10  // Задаем погрешность
+#include "s21_element_traits.h"
+
+namespace s21 {
+namespace expr {
+template <class E>
+class Base;  // Ленивое выражение над матрицами (s21_matrix_expr.h)
+}  // namespace expr
+
+template <class T>
+class MatrixView;  // Представление части матрицы (s21_matrix_view.h)
+}  // namespace s21
+
+// Алгоритм матричного умножения
+enum class S21MulAlgorithm {
+  kClassic,   // Блочный GEMM, O(n^3)
+  kStrassen,  // Штрассен-Виноград поверх GEMM (s21_strassen.h), O(n^2.81)
+};
+
+namespace s21 {
+
+// Плотная матрица с элементами типа T: float, double, long double или
+// std::complex от float и double (S21_MATRIX_ELEMENT_TYPES). Сравнение
+// использует погрешность ElementTraits<T>::kEpsilon; вырожденной считается
+// матрица, у которой при разложении встретился точно нулевой ведущий элемент.
+// Шаблон инстанцирован явно для этих типов, определения функций-членов
+// находятся в единицах трансляции.
+// Буфер выделяется из std::pmr::memory_resource, по умолчанию из
+// std::pmr::get_default_resource(). Ресурс переходит вместе с буфером при
+// перемещении и обмене и сохраняется при копирующем присваивании; копии и
+// результаты операций размещаются в ресурсе по умолчанию
+template <class T>
+class Matrix {
+ public:
+  using value_type = T;
+  using Real = RealOf<T>;  // Тип модуля элемента и погрешности
+  static constexpr Real kEpsilon = ElementTraits<T>::kEpsilon;
 
-class S21Matrix {
  private:
-  int rows_ = 0;  // Количество строк
-  int cols_ = 0;  // Количество столбцов
-  double** matrix_ =
-      nullptr;  // Указатель на двумерный массив для хранения матрицы
+  int rows_ = 0;    // Количество строк
+  int cols_ = 0;    // Количество столбцов
+  int stride_ = 0;  // Шаг между началами строк (в элементах)
+  T* matrix_ =
+      nullptr;  // Непрерывный выровненный буфер rows_ * stride_ элементов
+                // (значения в хвосте строки после cols_ не определены)
+  std::pmr::memory_resource* resource_ =
+      std::pmr::get_default_resource();  // Источник памяти буфера
   /* data */
+  void allocate(int rows, int cols);  // Выделение обнулённого буфера
+  void allocateUninitialized(
+      int rows, int cols);  // Выделение буфера с обнулённым хвостом строк
+  template <class E>
+  void assignExpr(const E& expr);  // Вычисление выражения в текущую матрицу
   void freeMemory() noexcept;  // Освобождение памяти
+  struct Uninitialized {};
+  Matrix(int rows, int cols, Uninitialized,
+         std::pmr::memory_resource* resource =
+             std::pmr::get_default_resource());  // Без обнуления элементов
+  T* row(int i) const noexcept {
+    return matrix_ + static_cast<std::ptrdiff_t>(i) * stride_;
+  }  // Указатель на начало строки i
 
  public:
   // Конструкторы и деструктор
-  S21Matrix();  // Конструктор по умолчанию
-  S21Matrix(int rows, int cols);  // Конструктор с параметрами
-  S21Matrix(const S21Matrix& other);  // Конструктор копирования
-  S21Matrix(S21Matrix&& other);  // Конструктор перемещения
-  ~S21Matrix();                  // Деструктор
+  Matrix();  // Конструктор по умолчанию
+  Matrix(int rows, int cols);  // Конструктор с параметрами
+  Matrix(int rows, int cols,
+         std::pmr::memory_resource* resource);  // Буфер из заданного ресурса
+  Matrix(const Matrix& other);  // Конструктор копирования
+  Matrix(const Matrix& other,
+         std::pmr::memory_resource* resource);  // Копия в заданном ресурсе
+  Matrix(Matrix&& other) noexcept;  // Конструктор перемещения
+  template <class E>
+  Matrix(const expr::Base<E>& expr);  // Вычисление выражения
+  template <class E>
+  Matrix(expr::Base<E>&& expr);  // Вычисление с захватом буфера
+  ~Matrix();                     // Деструктор
 
   // Функции для работы с матрицей
   void printMatrix() noexcept;  // Вывод матрицы на экран
   void fillMatrix() noexcept;  // Заполнение матрицы с клавиатуры
   void fillMatrix(
-      const double val) noexcept;  // Заполнение матрицы заданным значением
+      const T val) noexcept;  // Заполнение матрицы заданным значением
   void fillMatrixArr(
-      const double* arr) noexcept;  // Заполнение матрицы массивом значений
-  void swap(S21Matrix& other) noexcept;  // Обмен содержимым двух матриц
-  S21Matrix minorMatrix(int im, int jm) noexcept;  // Получение минора матрицы
+      const T* arr) noexcept;  // Заполнение матрицы массивом значений
+  void swap(Matrix& other) noexcept;  // Обмен содержимым двух матриц
+
+  // Текстовый и двоичный ввод-вывод (s21_matrix_io.h)
+  void writeText(std::ostream& out,
+                 char separator = ' ') const;  // Буферизованная запись
+  static Matrix readText(
+      std::istream& in);  // Чтение строк чисел через пробелы, ',' или ';'
+  void saveBinary(const std::string& path) const;  // Сохранение в файл
+  static Matrix loadBinary(
+      const std::string& path);  // Чтение файла в новую матрицу
+  Matrix minorMatrix(int im, int jm,
+                     std::pmr::memory_resource* resource =
+                         std::pmr::get_default_resource())
+      noexcept;  // Получение минора матрицы
+
+  // Выравнивание буфера и каждой строки (в байтах)
+  static constexpr std::size_t kAlignment = 64;
+  static_assert(kAlignment % sizeof(T) == 0,
+                "Element size must divide the row alignment");
 
   // Операции над матрицами
-  bool EqMatrix(const S21Matrix& other) const;  // Проверка на равенство матриц
-  void SumMatrix(const S21Matrix& other);  // Сложение матриц
-  void SubMatrix(const S21Matrix& other);  // Вычитание матриц
-  void MulNumber(const double num);  // Умножение матрицы на число
-  void MulMatrix(const S21Matrix& other);  // Умножение матриц
-  S21Matrix Transpose();  // Транспонирование матрицы
-  S21Matrix CalcComplements();  // Вычисление матрицы дополнений
-  double Determinant();  // Вычисление определителя матрицы
-  S21Matrix InverseMatrix();  // Вычисление обратной матрицы
+  bool EqMatrix(const Matrix& other) const;  // Проверка на равенство матриц
+  bool EqMatrix(const MatrixView<T>& other) const;  // Сравнение с частью
+  void SumMatrix(const Matrix& other);  // Сложение матриц
+  void SumMatrix(const MatrixView<T>& other);  // Сложение с частью матрицы
+  void SubMatrix(const Matrix& other);  // Вычитание матриц
+  void SubMatrix(const MatrixView<T>& other);  // Вычитание части матрицы
+  void MulNumber(const T num);  // Умножение матрицы на число
+  void MulMatrix(const Matrix& other);  // Умножение матриц
+  void MulMatrix(const MatrixView<T>& other);  // Умножение на часть матрицы
+  void MulMatrix(const Matrix& other,
+                 S21MulAlgorithm algorithm);  // Умножение выбранным алгоритмом
+  void MulAddMatrix(
+      const MatrixView<T>& a,
+      const MatrixView<T>& b);  // Накопление произведения: this += a * b
+  Matrix Transpose();  // Транспонирование матрицы
+  void TransposeInPlace();  // Транспонирование на месте
+  Matrix CalcComplements();  // Вычисление матрицы дополнений
+  T Determinant();  // Вычисление определителя матрицы
+  Matrix InverseMatrix();  // Вычисление обратной матрицы
+
+  // Представления без копирования (s21_matrix_view.h)
+  MatrixView<T> Submatrix(int row, int col, int rows,
+                          int cols) const;  // Блок rows x cols с (row, col)
+  MatrixView<T> RowSlice(int i) const;  // Строка i
+  MatrixView<T> ColSlice(int j) const;  // Столбец j
+  MatrixView<T> TransposeView() const;  // Ленивое транспонирование
 
   // Перегрузка операторов
-  S21Matrix& operator=(
-      S21Matrix const& other);  // Оператор присваивания для копирования
-  S21Matrix& operator=(
-      S21Matrix&& other);  // Оператор присваивания для перемещения
-  S21Matrix operator+(
-      const S21Matrix& other) const;  // Оператор сложения матриц
-  S21Matrix operator-(
-      const S21Matrix& other) const;  // Оператор вычитания матриц
-  S21Matrix& operator+=(
-      const S21Matrix& other);  // Оператор сложения с присваиванием
-  S21Matrix& operator-=(
-      const S21Matrix& other);  // Оператор вычитания с присваиванием
-  S21Matrix operator*(
-      const S21Matrix& other) const;  // Оператор умножения матриц
-  S21Matrix operator*(
-      const double num) const;  // Оператор умножения матрицы на число
-  S21Matrix& operator*=(
-      const double num);  // Оператор умножения на число с присваиванием
-  S21Matrix& operator*=(
-      const S21Matrix& other);  // Оператор умножения с присваиванием
+  Matrix& operator=(
+      Matrix const& other);  // Оператор присваивания для копирования
+  Matrix& operator=(
+      Matrix&& other) noexcept;  // Оператор присваивания для перемещения
+  template <class E>
+  Matrix& operator=(
+      const expr::Base<E>& expr);  // Присваивание выражения за один проход
+  template <class E>
+  Matrix& operator=(
+      expr::Base<E>&& expr);  // Присваивание с захватом буфера
+  Matrix& operator+=(
+      const Matrix& other);  // Оператор сложения с присваиванием
+  Matrix& operator-=(
+      const Matrix& other);  // Оператор вычитания с присваиванием
+  template <class E>
+  Matrix& operator+=(
+      const expr::Base<E>& expr);  // Сложение с выражением
+  template <class E>
+  Matrix& operator-=(
+      const expr::Base<E>& expr);  // Вычитание выражения
+  Matrix operator*(
+      const Matrix& other) const;  // Оператор умножения матриц
+  Matrix operator*(
+      const MatrixView<T>& other) const;  // Умножение на часть матрицы
+  Matrix& operator*=(
+      const T num);  // Оператор умножения на число с присваиванием
+  Matrix& operator*=(
+      const Matrix& other);  // Оператор умножения с присваиванием
+  Matrix& operator*=(
+      const MatrixView<T>& other);  // Умножение на часть с присваиванием
   bool operator==(
-      const S21Matrix& other) const;  // Оператор сравнения матриц на равенство
-  double& operator()(
+      const Matrix& other) const;  // Оператор сравнения матриц на равенство
+  bool operator==(
+      const MatrixView<T>& other) const;  // Сравнение с частью матрицы
+  T& operator()(
       int i, int j) const;  // Оператор доступа к элементу матрицы по индексам
 
   // Геттеры и сеттеры для количества строк и столбцов
@@ -79,8 +189,23 @@ class S21Matrix {
   int getCols() const;  // Получение количества столбцов
   void setRows(int rows);  // Установка количества строк
   void setCols(int cols);  // Установка количества столбцов
-  double& getElem(int i,
-                  int j) const;  // Получение элемента матрицы по индексам
+  T& getElem(int i,
+             int j) const;  // Получение элемента матрицы по индексам
+
+  // Прямой доступ к хранилищу: элемент (i, j) лежит в data()[i * stride() + j]
+  T* data() noexcept;  // Указатель на начало буфера
+  const T* data() const noexcept;  // Указатель на начало буфера
+  int stride() const noexcept;  // Шаг между строками в элементах
+  std::pmr::memory_resource* resource() const noexcept;  // Источник памяти
 };
 
+}  // namespace s21
+
+using S21Matrix = s21::Matrix<double>;  // Матрица по умолчанию
+using S21MatrixView = s21::MatrixView<double>;
+
+// Операторы +, - и умножение на число строят ленивые выражения
+#include "s21_matrix_expr.h"
+#include "s21_matrix_view.h"
+
 #endif  // S21_MATRIX_OOP_H
@@ -0,0 +1,151 @@
+#include "s21_matrix_view.h"
+
+#include "s21_blas.h"
+
+namespace s21 {
+
+// Представление всей матрицы
+template <class T>
+MatrixView<T>::MatrixView(const Matrix<T>& m) noexcept
+    : data_(const_cast<T*>(m.data())),
+      rows_(m.getRows()),
+      cols_(m.getCols()),
+      rowStride_(m.stride()),
+      colStride_(1) {}
+
+// Представление произвольного буфера с заданными шагами
+template <class T>
+MatrixView<T>::MatrixView(T* data, int rows, int cols,
+                          std::ptrdiff_t rowStride, std::ptrdiff_t colStride)
+    : data_(data),
+      rows_(rows),
+      cols_(cols),
+      rowStride_(rowStride),
+      colStride_(colStride) {
+  if (rows < 0 || cols < 0)
+    throw std::invalid_argument("Negative matrix dimensions");
+  if (rowStride < 0 || colStride < 0)
+    throw std::invalid_argument("Negative view stride");
+}
+
+// Доступ к элементу с проверкой индексов
+template <class T>
+T& MatrixView<T>::operator()(int i, int j) const {
+  if (i < 0 || i >= rows_ || j < 0 || j >= cols_)
+    throw std::out_of_range("Index out of range");
+  return data_[i * rowStride_ + j * colStride_];
+}
+
+// Блок rows x cols, начинающийся с элемента (row, col)
+template <class T>
+MatrixView<T> MatrixView<T>::Submatrix(int row, int col, int rows,
+                                       int cols) const {
+  if (row < 0 || col < 0 || rows < 0 || cols < 0 || row + rows > rows_ ||
+      col + cols > cols_)
+    throw std::out_of_range("Index out of range");
+  return {data_ + row * rowStride_ + col * colStride_, rows, cols, rowStride_,
+          colStride_};
+}
+
+// Строка i как матрица 1 x cols
+template <class T>
+MatrixView<T> MatrixView<T>::RowSlice(int i) const {
+  return Submatrix(i, 0, 1, cols_);
+}
+
+// Столбец j как матрица rows x 1
+template <class T>
+MatrixView<T> MatrixView<T>::ColSlice(int j) const {
+  return Submatrix(0, j, rows_, 1);
+}
+
+// Транспонирование без копирования: строки и столбцы меняются шагами
+template <class T>
+MatrixView<T> MatrixView<T>::TransposeView() const noexcept {
+  MatrixView result(*this);
+  std::swap(result.rows_, result.cols_);
+  std::swap(result.rowStride_, result.colStride_);
+  return result;
+}
+
+// Копирование элементов другого представления того же размера
+template <class T>
+MatrixView<T>& MatrixView<T>::operator=(const MatrixView& other) {
+  return *this = static_cast<const expr::Base<MatrixView>&>(other);
+}
+
+// Копирование элементов матрицы того же размера
+template <class T>
+MatrixView<T>& MatrixView<T>::operator=(const Matrix<T>& other) {
+  return *this = expr::Ref<T>(other);
+}
+
+template <class T>
+MatrixView<T>& MatrixView<T>::operator+=(const Matrix<T>& other) {
+  return *this = *this + other;
+}
+
+template <class T>
+MatrixView<T>& MatrixView<T>::operator-=(const Matrix<T>& other) {
+  return *this = *this - other;
+}
+
+template <class T>
+MatrixView<T>& MatrixView<T>::operator*=(const T num) {
+  return *this = *this * num;
+}
+
+// Заполнение всех элементов представления одним значением
+template <class T>
+void MatrixView<T>::fillMatrix(const T val) {
+  for (auto i = 0; i < rows_; ++i) {
+    for (auto j = 0; j < cols_; ++j)
+      data_[i * rowStride_ + j * colStride_] = val;
+  }
+}
+
+// Произведение представлений через GEMM с их шагами
+template <class T>
+Matrix<T> MatrixView<T>::Multiply(const MatrixView& l, const MatrixView& r) {
+  if (l.getCols() != r.getRows())
+    throw std::invalid_argument(
+        "The number of columns in the first matrix is not equal to the rows in "
+        "second matrix");
+
+  Matrix<T> res(l.getRows(), r.getCols());
+  blas::Gemm(T(1), l, r, T(), res);
+  return res;
+}
+
+// Представления частей матрицы
+template <class T>
+MatrixView<T> Matrix<T>::Submatrix(int row, int col, int rows,
+                                   int cols) const {
+  return MatrixView<T>(*this).Submatrix(row, col, rows, cols);
+}
+
+template <class T>
+MatrixView<T> Matrix<T>::RowSlice(int i) const {
+  return MatrixView<T>(*this).RowSlice(i);
+}
+
+template <class T>
+MatrixView<T> Matrix<T>::ColSlice(int j) const {
+  return MatrixView<T>(*this).ColSlice(j);
+}
+
+template <class T>
+MatrixView<T> Matrix<T>::TransposeView() const {
+  return MatrixView<T>(*this).TransposeView();
+}
+
+#define S21_INSTANTIATE(T)                                               \
+  template class MatrixView<T>;                                          \
+  template MatrixView<T> Matrix<T>::Submatrix(int, int, int, int) const; \
+  template MatrixView<T> Matrix<T>::RowSlice(int) const;                 \
+  template MatrixView<T> Matrix<T>::ColSlice(int) const;                 \
+  template MatrixView<T> Matrix<T>::TransposeView() const;
+S21_MATRIX_ELEMENT_TYPES(S21_INSTANTIATE)
+#undef S21_INSTANTIATE
+
+}  // namespace s21
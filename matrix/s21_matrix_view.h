@@ -0,0 +1,136 @@
+#ifndef S21_MATRIX_VIEW_H
+#define S21_MATRIX_VIEW_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+#include "s21_matrix_expr.h"
+#include "s21_matrix_oop.h"
+#include "s21_thread_pool.h"
+
+namespace s21 {
+
+// Представление прямоугольной части чужого буфера без владения и копирования:
+// элемент (i, j) лежит в data()[i * rowStride() + j * colStride()]. Блок,
+// строка, столбец и транспонирование отличаются только началом и шагами,
+// поэтому представления вкладываются друг в друга без выделения памяти.
+// Представление живёт не дольше матрицы, которой принадлежит буфер, и
+// участвует в выражениях наравне с Matrix. Присваивание представлению
+// записывает элементы в чужой буфер, а не перенаправляет его
+template <class T>
+class MatrixView : public expr::Base<MatrixView<T>> {
+ public:
+  using value_type = T;
+
+  // Конструкторы
+  MatrixView(const Matrix<T>& m) noexcept;  // Вся матрица
+  MatrixView(T* data, int rows, int cols, std::ptrdiff_t rowStride,
+             std::ptrdiff_t colStride = 1);  // Произвольный буфер
+  MatrixView(const MatrixView& other) = default;
+
+  // Размеры и расположение
+  int getRows() const noexcept { return rows_; }
+  int getCols() const noexcept { return cols_; }
+  std::ptrdiff_t rowStride() const noexcept { return rowStride_; }
+  std::ptrdiff_t colStride() const noexcept { return colStride_; }
+  T* data() const noexcept { return data_; }
+  expr::Region<T> region() const noexcept {
+    return {data_, rows_, cols_, rowStride_, colStride_};
+  }
+
+  // Доступ к элементам
+  T& operator()(int i, int j) const;
+
+  // Вложенные представления
+  MatrixView Submatrix(int row, int col, int rows,
+                       int cols) const;  // Блок rows x cols с (row, col)
+  MatrixView RowSlice(int i) const;      // Строка i
+  MatrixView ColSlice(int j) const;      // Столбец j
+  MatrixView TransposeView() const noexcept;  // Обмен шагов
+
+  // Запись через представление
+  MatrixView& operator=(const MatrixView& other);  // Копия элементов
+  MatrixView& operator=(const Matrix<T>& other);
+  template <class E>
+  MatrixView& operator=(const expr::Base<E>& expr);
+  MatrixView& operator+=(const Matrix<T>& other);
+  MatrixView& operator-=(const Matrix<T>& other);
+  template <class E>
+  MatrixView& operator+=(const expr::Base<E>& expr);
+  template <class E>
+  MatrixView& operator-=(const expr::Base<E>& expr);
+  MatrixView& operator*=(const T num);
+  void fillMatrix(const T val);  // Заполнение значением
+
+  // Узел выражения
+  struct Row {
+    const T* p;
+    std::ptrdiff_t step;
+    T operator[](int j) const noexcept { return p[j * step]; }
+  };
+  Row row(int i) const noexcept { return {data_ + i * rowStride_, colStride_}; }
+  Matrix<T>* reusable() noexcept { return nullptr; }
+  bool aliases(const expr::Region<T>& target) const noexcept {
+    return region().conflictsWith(target);
+  }
+
+  // Произведение представлений: шаги передаются в GEMM, поэтому блоки и
+  // транспонированные множители не копируются. Функция находится поиском по
+  // аргументам, поэтому матрица в любой позиции приводится к представлению
+  friend Matrix<T> operator*(const MatrixView& l, const MatrixView& r) {
+    return Multiply(l, r);
+  }
+
+ private:
+  static Matrix<T> Multiply(const MatrixView& l, const MatrixView& r);
+
+  T* data_;
+  int rows_;
+  int cols_;
+  std::ptrdiff_t rowStride_;
+  std::ptrdiff_t colStride_;
+};
+
+// Построчная запись выражения. Если выражение читает пересекающуюся с
+// представлением область по другим индексам, оно сначала вычисляется во
+// временную матрицу
+template <class T>
+template <class E>
+MatrixView<T>& MatrixView<T>::operator=(const expr::Base<E>& expr) {
+  static_assert(std::is_same_v<typename E::value_type, T>,
+                "Expression must have the same element type");
+  if (rows_ != expr.getRows() || cols_ != expr.getCols())
+    throw std::invalid_argument("Different matrix dimensions");
+  if (expr.self().aliases(region())) {
+    const Matrix<T> tmp(expr);
+    return *this = tmp;
+  }
+
+  const E& e = expr.self();
+  auto& pool = S21ThreadPool::instance();
+  pool.forEachRowBlock(rows_, cols_, [&](int begin, int end) {
+    for (auto i = begin; i < end; ++i) {
+      T* dst = data_ + i * rowStride_;
+      const auto src = e.row(i);
+      for (auto j = 0; j < cols_; ++j) dst[j * colStride_] = src[j];
+    }
+  });
+  return *this;
+}
+
+template <class T>
+template <class E>
+MatrixView<T>& MatrixView<T>::operator+=(const expr::Base<E>& expr) {
+  return *this = *this + expr.self();
+}
+
+template <class T>
+template <class E>
+MatrixView<T>& MatrixView<T>::operator-=(const expr::Base<E>& expr) {
+  return *this = *this - expr.self();
+}
+
+}  // namespace s21
+
+#endif  // S21_MATRIX_VIEW_H
@@ -0,0 +1,216 @@
+#include "s21_qr.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "s21_gemm.h"
+#include "s21_scratch_arena.h"
+#include "s21_simd.h"
+#include "s21_thread_pool.h"
+
+namespace s21 {
+
+// Разложение матрицы a
+template <class T>
+QR<T>::QR(const Matrix<T>& a)
+    : qr_(a), t_(std::min(kBlock, a.getCols()), a.getCols()) {
+  if (a.getRows() < a.getCols())
+    throw std::invalid_argument(
+        "The matrix has fewer rows than columns");  // Проверка размеров
+
+  factorize();
+}
+
+// Блок столбцов [k, kEnd) раскладывается по столбцам: отражение j обнуляет
+// столбец под диагональю и сразу применяется к остальным столбцам блока.
+// Затем строится множитель T блока, и блочное отражение применяется к
+// столбцам правее блока
+template <class T>
+void QR<T>::factorize() {
+  using Real = RealOf<T>;
+  const int m = qr_.getRows();
+  const int n = qr_.getCols();
+  const std::ptrdiff_t ld = qr_.stride();
+  const std::ptrdiff_t ldt = t_.stride();
+  T* a = qr_.data();
+  T* t = t_.data();
+
+  // Диагональ R_jj считается нулевой, если она не превосходит погрешности
+  // округления max(m, n) * eps * ||A(:, j)||: порог масштабируется по
+  // каждому столбцу отдельно и не зависит от масштаба остальных
+  const Real roundoff =
+      Real(std::max(m, n)) * std::numeric_limits<Real>::epsilon();
+  std::pmr::vector<Real> tolerance(n, Real(0), &ScratchArena::local());
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < n; ++j) tolerance[j] += std::norm(a[i * ld + j]);
+  }
+  for (Real& x : tolerance) x = roundoff * std::sqrt(x);
+
+  std::pmr::vector<T> w(kBlock, &ScratchArena::local());
+  for (int k = 0; k < n; k += kBlock) {
+    const int kEnd = std::min(k + kBlock, n);
+    const int kb = kEnd - k;
+
+    for (int j = k; j < kEnd; ++j) {
+      // Отражение H = I - tau * v * v^H с v_j = 1 переводит столбец в
+      // beta * e_j; знак (фаза) beta противоположен alpha, чтобы избежать
+      // вычитания близких чисел
+      Real tail = 0;
+      for (int i = j + 1; i < m; ++i) tail += std::norm(a[i * ld + j]);
+      const T alpha = a[j * ld + j];
+      const Real norm = std::sqrt(std::norm(alpha) + tail);
+      T tau = T();
+      if (norm > 0) {
+        const T phase = alpha == T() ? T(1) : alpha / std::abs(alpha);
+        const T beta = -phase * norm;
+        const T v0 = alpha - beta;
+        for (int i = j + 1; i < m; ++i) a[i * ld + j] /= v0;
+        tau = T(Real(2) / (Real(1) + tail / std::norm(v0)));
+        a[j * ld + j] = beta;
+      }
+      if (!(std::abs(a[j * ld + j]) > tolerance[j])) fullRank_ = false;
+      t[(j - k) * ldt + j] = tau;
+
+      // Применение к столбцам (j, kEnd) построчно: w = v^H * A, A -= tau v w
+      const int cols = kEnd - j - 1;
+      if (cols == 0 || tau == T()) continue;
+      std::copy(a + j * ld + j + 1, a + j * ld + kEnd, w.begin());
+      for (int i = j + 1; i < m; ++i) {
+        const T vi = Conjugate(a[i * ld + j]);
+        for (int c = 0; c < cols; ++c) w[c] += vi * a[i * ld + j + 1 + c];
+      }
+      for (int c = 0; c < cols; ++c) a[j * ld + j + 1 + c] -= tau * w[c];
+      for (int i = j + 1; i < m; ++i) {
+        const T vi = tau * a[i * ld + j];
+        for (int c = 0; c < cols; ++c) a[i * ld + j + 1 + c] -= vi * w[c];
+      }
+    }
+
+    // T(0:jj, jj) = -tau_jj * T(0:jj, 0:jj) * V(:, 0:jj)^H * v_jj
+    for (int jj = 1; jj < kb; ++jj) {
+      const int j = k + jj;
+      for (int c = 0; c < jj; ++c) w[c] = Conjugate(a[j * ld + k + c]);
+      for (int i = j + 1; i < m; ++i) {
+        const T vi = a[i * ld + j];
+        for (int c = 0; c < jj; ++c) w[c] += Conjugate(a[i * ld + k + c]) * vi;
+      }
+      const T tau = t[jj * ldt + j];
+      for (int r = 0; r < jj; ++r) {
+        T sum = T();
+        for (int q = r; q < jj; ++q) sum += t[r * ldt + k + q] * w[q];
+        t[r * ldt + j] = -tau * sum;
+      }
+    }
+
+    if (kEnd < n) applyBlock(k, kb, a + kEnd, ld, n - kEnd);
+  }
+}
+
+// Явные V (с единицами на диагонали и нулями над ней) и V^H блока
+template <class T>
+void QR<T>::reflectors(int k, int kb, Matrix<T>& v, Matrix<T>& vh) const {
+  const int rows = qr_.getRows() - k;
+  const std::ptrdiff_t ld = qr_.stride();
+  const T* a = qr_.data() + k * ld + k;
+  T* pv = v.data();
+  T* pvh = vh.data();
+  for (int i = 0; i < rows; ++i) {
+    for (int c = 0; c < kb; ++c) {
+      const T value = i == c ? T(1) : i < c ? T() : a[i * ld + c];
+      pv[i * v.stride() + c] = value;
+      pvh[c * vh.stride() + i] = Conjugate(value);
+    }
+  }
+}
+
+// C(k:m, :) -= V * (T^H * (V^H * C(k:m, :))): два вызова GEMM и
+// треугольное умножение kb x kb между ними
+template <class T>
+void QR<T>::applyBlock(int k, int kb, T* c, std::ptrdiff_t ldc,
+                       int cols) const {
+  // Временные матрицы освобождаются в обратном порядке и переиспользуют
+  // одно место арены для всех блоков
+  ScratchArena& arena = ScratchArena::local();
+  const int rows = qr_.getRows() - k;
+  Matrix<T> v(rows, kb, &arena);
+  Matrix<T> vh(kb, rows, &arena);
+  reflectors(k, kb, v, vh);
+
+  Matrix<T> w(kb, cols, &arena);
+  const std::ptrdiff_t ldw = w.stride();
+  T* pw = w.data();
+  gemm::MulAdd(kb, cols, rows, T(1), vh.data(), vh.stride(), 1, c + k * ldc,
+               ldc, 1, pw, ldw);
+
+  // W = T^H * W; T^H нижнетреугольная, строки обновляются снизу вверх
+  const T* t = t_.data() + k;
+  const std::ptrdiff_t ldt = t_.stride();
+  const auto& simd = simd::Active<T>();
+  S21ThreadPool::instance().parallelFor(
+      cols, triangular::kColumnGrain, [&](int begin, int end) {
+        for (int r = kb - 1; r >= 0; --r) {
+          T* row = pw + r * ldw + begin;
+          simd.scale(row, Conjugate(t[r * ldt + r]), end - begin);
+          for (int q = 0; q < r; ++q) {
+            simd.axpy(row, Conjugate(t[q * ldt + r]), pw + q * ldw + begin,
+                      end - begin);
+          }
+        }
+      });
+
+  gemm::MulAdd(rows, cols, kb, T(-1), v.data(), v.stride(), 1, pw, ldw, 1,
+               c + k * ldc, ldc);
+}
+
+// Все столбцы A линейно независимы
+template <class T>
+bool QR<T>::isFullRank() const noexcept { return fullRank_; }
+
+// Решение задачи наименьших квадратов: R * X = (Q^H * B)(0:n, :)
+template <class T>
+Matrix<T> QR<T>::solve(const Matrix<T>& b) const {
+  if (b.getRows() != qr_.getRows())
+    throw std::invalid_argument(
+        "The number of rows in the right-hand side does not match the "
+        "matrix");  // Проверка на соответствие размеров
+  if (!fullRank_)
+    throw std::invalid_argument(
+        "Matrix does not have full column rank");  // Проверка ранга
+
+  const int n = qr_.getCols();
+  Matrix<T> y(b, &ScratchArena::local());
+  for (int k = 0; k < n; k += kBlock) {
+    applyBlock(k, std::min(kBlock, n - k), y.data(), y.stride(), y.getCols());
+  }
+
+  Matrix<T> x(n, b.getCols());
+  for (int i = 0; i < n; ++i) {
+    const T* row = y.data() + i * y.stride();
+    std::copy(row, row + y.getCols(), x.data() + i * x.stride());
+  }
+  triangular::SolveUpper(n, x.getCols(), qr_.data(), qr_.stride(), x.data(),
+                         x.stride());
+  return x;
+}
+
+// Верхнетреугольный множитель R размера n x n
+template <class T>
+Matrix<T> QR<T>::r() const {
+  const int n = qr_.getCols();
+  Matrix<T> result(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = i; j < n; ++j) result(i, j) = qr_(i, j);
+  }
+  return result;
+}
+
+template <class T>
+const Matrix<T>& QR<T>::packed() const noexcept { return qr_; }
+
+#define S21_INSTANTIATE(T) template class QR<T>;
+S21_MATRIX_ELEMENT_TYPES(S21_INSTANTIATE)
+#undef S21_INSTANTIATE
+
+}  // namespace s21
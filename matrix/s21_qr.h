@@ -0,0 +1,46 @@
+#ifndef S21_QR_H
+#define S21_QR_H
+
+#include "s21_matrix_oop.h"
+#include "s21_triangular.h"
+
+namespace s21 {
+
+// QR-разложение прямоугольной матрицы m x n (m >= n) отражениями
+// Хаусхолдера: A = Q * R, Q унитарная, R верхнетреугольная n x n. Отражения
+// блока из kBlock столбцов собираются в компактную форму
+// I - V * T * V^H и применяются к остальной матрице двумя вызовами GEMM.
+// Разложение выполняется один раз и переиспользуется для решения задач
+// наименьших квадратов с разными правыми частями
+template <class T>
+class QR {
+ public:
+  // Размер блока столбцов (отражений в одном блочном отражении)
+  static constexpr int kBlock = triangular::kBlock;
+
+  explicit QR(const Matrix<T>& a);  // Разложение матрицы a
+
+  bool isFullRank() const noexcept;  // Линейно независимы ли столбцы A
+  Matrix<T> solve(const Matrix<T>& b)
+      const;  // X (n x k), минимизирующая ||A * X - B|| по каждому столбцу
+  Matrix<T> r() const;  // Множитель R
+
+  const Matrix<T>& packed() const noexcept;  // R и векторы отражений под ней
+
+ private:
+  void factorize();  // Блочное разложение на месте
+  void reflectors(int k, int kb, Matrix<T>& v,
+                  Matrix<T>& vh) const;  // V и V^H блока [k, k + kb)
+  void applyBlock(int k, int kb, T* c, std::ptrdiff_t ldc,
+                  int cols) const;  // C(k:m, :) = (I - V T V^H)^H C(k:m, :)
+
+  Matrix<T> qr_;  // R на диагонали и выше, векторы отражений ниже
+  Matrix<T> t_;   // Треугольные множители T блоков в столбцах [k, k + kb)
+  bool fullRank_ = true;  // На диагонали R нет нулей
+};
+
+}  // namespace s21
+
+using S21QR = s21::QR<double>;
+
+#endif  // S21_QR_H
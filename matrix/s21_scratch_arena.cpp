@@ -0,0 +1,113 @@
+#include "s21_scratch_arena.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+namespace s21 {
+
+namespace {
+
+// Выравнивание начала блоков: строка кэша и выравнивание строк матриц
+constexpr std::size_t kChunkAlignment = 64;
+
+}  // namespace
+
+// Арена текущего потока
+ScratchArena& ScratchArena::local() noexcept {
+  thread_local ScratchArena arena;
+  return arena;
+}
+
+ScratchArena::ScratchArena(std::pmr::memory_resource* upstream) noexcept
+    : upstream_(upstream) {}
+
+ScratchArena::~ScratchArena() { release(); }
+
+// Байт во всех блоках
+std::size_t ScratchArena::capacity() const noexcept {
+  std::size_t total = 0;
+  for (const Chunk& chunk : chunks_) total += chunk.size;
+  return total;
+}
+
+// Возврат всех блоков вышестоящему ресурсу
+void ScratchArena::release() noexcept {
+  for (const Chunk& chunk : chunks_)
+    upstream_->deallocate(chunk.data, chunk.size, kChunkAlignment);
+  chunks_.clear();
+  current_ = 0;
+  offset_ = 0;
+  live_ = 0;
+}
+
+// Выделение сдвигом в текущем блоке; если места не хватает, используется
+// следующий блок, а при их отсутствии запрашивается новый вдвое больше
+// последнего
+void* ScratchArena::do_allocate(std::size_t bytes, std::size_t alignment) {
+  for (;;) {
+    if (current_ < chunks_.size()) {
+      const Chunk& chunk = chunks_[current_];
+      const auto base = reinterpret_cast<std::uintptr_t>(chunk.data);
+      const std::uintptr_t start =
+          (base + offset_ + alignment - 1) / alignment * alignment;
+      if (start + bytes <= base + chunk.size) {
+        offset_ = start + bytes - base;
+        ++live_;
+        return reinterpret_cast<void*>(start);
+      }
+      ++current_;
+      offset_ = 0;
+      continue;
+    }
+
+    const std::size_t previous = chunks_.empty() ? 0 : chunks_.back().size;
+    const std::size_t size =
+        std::max({kMinChunk, 2 * previous, bytes + alignment});
+    chunks_.reserve(chunks_.size() + 1);
+    chunks_.push_back(
+        {static_cast<char*>(upstream_->allocate(size, kChunkAlignment)),
+         size});
+    current_ = chunks_.size() - 1;
+    offset_ = 0;
+  }
+}
+
+// Последнее выделение текущего блока возвращается сразу, остальные — при
+// освобождении всех выделений
+void ScratchArena::do_deallocate(void* p, std::size_t bytes, std::size_t) {
+  if (--live_ == 0) {
+    reset();
+    return;
+  }
+  if (current_ < chunks_.size()) {
+    char* top = chunks_[current_].data + offset_;
+    if (static_cast<char*>(p) + bytes == top)
+      offset_ = static_cast<char*>(p) - chunks_[current_].data;
+  }
+}
+
+bool ScratchArena::do_is_equal(
+    const std::pmr::memory_resource& other) const noexcept {
+  return this == &other;
+}
+
+// Несколько блоков заменяются одним общего размера, чтобы следующий такой
+// же набор выделений поместился без запросов к вышестоящему ресурсу
+void ScratchArena::reset() noexcept {
+  current_ = 0;
+  offset_ = 0;
+  if (chunks_.size() <= 1) return;
+
+  const std::size_t total = capacity();
+  release();
+  try {
+    chunks_.push_back(
+        {static_cast<char*>(upstream_->allocate(total, kChunkAlignment)),
+         total});
+  } catch (const std::bad_alloc&) {
+    // Блок будет выделен заново при следующем запросе
+  }
+}
+
+}  // namespace s21
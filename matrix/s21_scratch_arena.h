@@ -0,0 +1,62 @@
+#ifndef S21_SCRATCH_ARENA_H
+#define S21_SCRATCH_ARENA_H
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+namespace s21 {
+
+// Арена для временных буферов внутренних алгоритмов библиотеки, своя у
+// каждого потока. Память выделяется сдвигом указателя в больших блоках,
+// а освобождение в обратном порядке (как у вложенных временных матриц)
+// сразу возвращает место. Когда освобождены все выделения, арена
+// сбрасывается к началу, а несколько блоков заменяются одним общим
+// размером, так что после прогрева повторяющиеся операции не обращаются к
+// глобальной куче.
+//
+// Память арены нельзя передавать в другой поток и нельзя отдавать
+// пользователю: объекты из неё должны уничтожаться в том же потоке, обычно
+// в той же функции
+class ScratchArena final : public std::pmr::memory_resource {
+ public:
+  // Минимальный размер блока, запрашиваемого у вышестоящего ресурса
+  static constexpr std::size_t kMinChunk = std::size_t(1) << 16;
+
+  static ScratchArena& local() noexcept;  // Арена текущего потока
+
+  explicit ScratchArena(std::pmr::memory_resource* upstream =
+                            std::pmr::new_delete_resource()) noexcept;
+  ScratchArena(const ScratchArena&) = delete;
+  ScratchArena& operator=(const ScratchArena&) = delete;
+  ~ScratchArena() override;
+
+  std::size_t capacity() const noexcept;  // Байт во всех блоках
+  std::size_t liveAllocations() const noexcept {
+    return live_;
+  }  // Ещё не освобождённые выделения
+  void release() noexcept;  // Возврат блоков вышестоящему ресурсу
+
+ private:
+  struct Chunk {
+    char* data;
+    std::size_t size;
+  };
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* p, std::size_t bytes,
+                     std::size_t alignment) override;
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override;
+  void reset() noexcept;  // Сброс после освобождения всех выделений
+
+  std::pmr::memory_resource* upstream_;
+  std::vector<Chunk> chunks_;  // Блоки в порядке заполнения
+  std::size_t current_ = 0;    // Заполняемый блок
+  std::size_t offset_ = 0;     // Занято байт в заполняемом блоке
+  std::size_t live_ = 0;       // Количество неосвобождённых выделений
+};
+
+}  // namespace s21
+
+#endif  // S21_SCRATCH_ARENA_H
@@ -0,0 +1,408 @@
+#include "s21_simd.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define S21_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define S21_SIMD_X86 0
+#endif
+
+namespace s21 {
+namespace simd {
+
+namespace {
+
+// |a - b| <= eps; комплексные числа сравниваются по квадрату модуля без
+// вызова hypot
+template <class T>
+bool Close(const T& a, const T& b, RealOf<T> eps) noexcept {
+  if constexpr (ElementTraits<T>::kComplex) {
+    return std::norm(a - b) <= eps * eps;
+  } else {
+    return std::abs(a - b) <= eps;
+  }
+}
+
+// Скалярные ядра: запасной вариант и обработка хвостов векторных ядер
+
+template <class T>
+void AddScalar(T* dst, const T* src, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) dst[i] += src[i];
+}
+
+template <class T>
+void SubScalar(T* dst, const T* src, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) dst[i] -= src[i];
+}
+
+template <class T>
+void ScaleScalar(T* dst, T alpha, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) dst[i] *= alpha;
+}
+
+template <class T>
+void AxpyScalar(T* dst, T alpha, const T* src, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) dst[i] += alpha * src[i];
+}
+
+template <class T>
+bool EqualScalar(const T* a, const T* b, std::size_t n, RealOf<T> eps) {
+  for (std::size_t i = 0; i < n; ++i) {
+    // Отрицание вместо > чтобы NaN считался неравенством
+    if (!Close(a[i], b[i], eps)) return false;
+  }
+  return true;
+}
+
+template <class T>
+constexpr BasicKernels<T> kScalar = {"scalar",       AddScalar<T>,
+                                     SubScalar<T>,   ScaleScalar<T>,
+                                     AxpyScalar<T>,  EqualScalar<T>};
+
+// Ядра для остальных типов элементов: те же циклы, которые компилятор
+// векторизует отдельно под каждый набор инструкций, а загрузчик выбирает
+// вариант по CPUID (кроме сборки с ThreadSanitizer, см. s21_gemm.cpp)
+#if S21_SIMD_X86 && !defined(__SANITIZE_THREAD__)
+#define S21_SIMD_CLONES                                            \
+  __attribute__((target_clones("avx512f", "avx2,fma", "default")))
+#else
+#define S21_SIMD_CLONES
+#endif
+
+template <class T>
+S21_SIMD_CLONES void AddAuto(T* dst, const T* src, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) dst[i] += src[i];
+}
+
+template <class T>
+S21_SIMD_CLONES void SubAuto(T* dst, const T* src, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) dst[i] -= src[i];
+}
+
+template <class T>
+S21_SIMD_CLONES void ScaleAuto(T* dst, T alpha, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) dst[i] *= alpha;
+}
+
+template <class T>
+S21_SIMD_CLONES void AxpyAuto(T* dst, T alpha, const T* src, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) dst[i] += alpha * src[i];
+}
+
+// Сравнение блоками без ветвлений внутри блока, чтобы цикл векторизовался;
+// выход после первого блока с различием
+template <class T>
+S21_SIMD_CLONES bool EqualAuto(const T* a, const T* b, std::size_t n,
+                               RealOf<T> eps) {
+  constexpr std::size_t kBlock = 256;
+  for (std::size_t begin = 0; begin < n; begin += kBlock) {
+    const std::size_t end = std::min(n, begin + kBlock);
+    bool close = true;
+    for (std::size_t i = begin; i < end; ++i) close &= Close(a[i], b[i], eps);
+    if (!close) return false;
+  }
+  return true;
+}
+
+#undef S21_SIMD_CLONES
+
+template <class T>
+const BasicKernels<T> kAuto = {"auto",       AddAuto<T>, SubAuto<T>,
+                               ScaleAuto<T>, AxpyAuto<T>, EqualAuto<T>};
+
+#if S21_SIMD_X86
+
+// SSE2: по 2 элемента за инструкцию
+
+__attribute__((target("sse2"))) void AddSse2(double* dst, const double* src,
+                                              std::size_t n) {
+  std::size_t i = 0;
+  for (; i + 2 <= n; i += 2) {
+    _mm_storeu_pd(dst + i,
+                  _mm_add_pd(_mm_loadu_pd(dst + i), _mm_loadu_pd(src + i)));
+  }
+  AddScalar(dst + i, src + i, n - i);
+}
+
+__attribute__((target("sse2"))) void SubSse2(double* dst, const double* src,
+                                              std::size_t n) {
+  std::size_t i = 0;
+  for (; i + 2 <= n; i += 2) {
+    _mm_storeu_pd(dst + i,
+                  _mm_sub_pd(_mm_loadu_pd(dst + i), _mm_loadu_pd(src + i)));
+  }
+  SubScalar(dst + i, src + i, n - i);
+}
+
+__attribute__((target("sse2"))) void ScaleSse2(double* dst, double alpha,
+                                                std::size_t n) {
+  const __m128d va = _mm_set1_pd(alpha);
+  std::size_t i = 0;
+  for (; i + 2 <= n; i += 2) {
+    _mm_storeu_pd(dst + i, _mm_mul_pd(_mm_loadu_pd(dst + i), va));
+  }
+  ScaleScalar(dst + i, alpha, n - i);
+}
+
+__attribute__((target("sse2"))) void AxpySse2(double* dst, double alpha,
+                                               const double* src,
+                                               std::size_t n) {
+  const __m128d va = _mm_set1_pd(alpha);
+  std::size_t i = 0;
+  for (; i + 2 <= n; i += 2) {
+    _mm_storeu_pd(dst + i, _mm_add_pd(_mm_loadu_pd(dst + i),
+                                      _mm_mul_pd(va, _mm_loadu_pd(src + i))));
+  }
+  AxpyScalar(dst + i, alpha, src + i, n - i);
+}
+
+__attribute__((target("sse2"))) bool EqualSse2(const double* a,
+                                                const double* b, std::size_t n,
+                                                double eps) {
+  const __m128d sign = _mm_set1_pd(-0.);
+  const __m128d veps = _mm_set1_pd(eps);
+  std::size_t i = 0;
+  for (; i + 2 <= n; i += 2) {
+    const __m128d diff = _mm_sub_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i));
+    const __m128d le = _mm_cmple_pd(_mm_andnot_pd(sign, diff), veps);
+    if (_mm_movemask_pd(le) != 0x3) return false;
+  }
+  return EqualScalar(a + i, b + i, n - i, eps);
+}
+
+constexpr Kernels kSse2 = {"sse2",    AddSse2,  SubSse2,
+                           ScaleSse2, AxpySse2, EqualSse2};
+
+// AVX2 + FMA: по 4 элемента за инструкцию, два регистра за итерацию
+
+__attribute__((target("avx2,fma"))) void AddAvx2(double* dst,
+                                                  const double* src,
+                                                  std::size_t n) {
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    const __m256d s0 = _mm256_loadu_pd(src + i);
+    const __m256d s1 = _mm256_loadu_pd(src + i + 4);
+    _mm256_storeu_pd(dst + i, _mm256_add_pd(_mm256_loadu_pd(dst + i), s0));
+    _mm256_storeu_pd(dst + i + 4,
+                     _mm256_add_pd(_mm256_loadu_pd(dst + i + 4), s1));
+  }
+  AddScalar(dst + i, src + i, n - i);
+}
+
+__attribute__((target("avx2,fma"))) void SubAvx2(double* dst,
+                                                  const double* src,
+                                                  std::size_t n) {
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    const __m256d s0 = _mm256_loadu_pd(src + i);
+    const __m256d s1 = _mm256_loadu_pd(src + i + 4);
+    _mm256_storeu_pd(dst + i, _mm256_sub_pd(_mm256_loadu_pd(dst + i), s0));
+    _mm256_storeu_pd(dst + i + 4,
+                     _mm256_sub_pd(_mm256_loadu_pd(dst + i + 4), s1));
+  }
+  SubScalar(dst + i, src + i, n - i);
+}
+
+__attribute__((target("avx2,fma"))) void ScaleAvx2(double* dst, double alpha,
+                                                    std::size_t n) {
+  const __m256d va = _mm256_set1_pd(alpha);
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm256_storeu_pd(dst + i, _mm256_mul_pd(_mm256_loadu_pd(dst + i), va));
+    _mm256_storeu_pd(dst + i + 4,
+                     _mm256_mul_pd(_mm256_loadu_pd(dst + i + 4), va));
+  }
+  ScaleScalar(dst + i, alpha, n - i);
+}
+
+__attribute__((target("avx2,fma"))) void AxpyAvx2(double* dst, double alpha,
+                                                   const double* src,
+                                                   std::size_t n) {
+  const __m256d va = _mm256_set1_pd(alpha);
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm256_storeu_pd(dst + i, _mm256_fmadd_pd(va, _mm256_loadu_pd(src + i),
+                                              _mm256_loadu_pd(dst + i)));
+    _mm256_storeu_pd(dst + i + 4,
+                     _mm256_fmadd_pd(va, _mm256_loadu_pd(src + i + 4),
+                                     _mm256_loadu_pd(dst + i + 4)));
+  }
+  AxpyScalar(dst + i, alpha, src + i, n - i);
+}
+
+__attribute__((target("avx2,fma"))) bool EqualAvx2(const double* a,
+                                                    const double* b,
+                                                    std::size_t n,
+                                                    double eps) {
+  const __m256d sign = _mm256_set1_pd(-0.);
+  const __m256d veps = _mm256_set1_pd(eps);
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    const __m256d diff =
+        _mm256_sub_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i));
+    const __m256d le =
+        _mm256_cmp_pd(_mm256_andnot_pd(sign, diff), veps, _CMP_LE_OQ);
+    if (_mm256_movemask_pd(le) != 0xF) return false;
+  }
+  return EqualScalar(a + i, b + i, n - i, eps);
+}
+
+constexpr Kernels kAvx2 = {"avx2",    AddAvx2,  SubAvx2,
+                           ScaleAvx2, AxpyAvx2, EqualAvx2};
+
+// AVX-512: по 8 элементов за инструкцию, хвост обрабатывается маской
+
+__attribute__((target("avx512f"))) void AddAvx512(double* dst,
+                                                   const double* src,
+                                                   std::size_t n) {
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm512_storeu_pd(dst + i, _mm512_add_pd(_mm512_loadu_pd(dst + i),
+                                            _mm512_loadu_pd(src + i)));
+  }
+  if (i < n) {
+    const __mmask8 m = static_cast<__mmask8>((1u << (n - i)) - 1);
+    _mm512_mask_storeu_pd(dst + i, m,
+                          _mm512_add_pd(_mm512_maskz_loadu_pd(m, dst + i),
+                                        _mm512_maskz_loadu_pd(m, src + i)));
+  }
+}
+
+__attribute__((target("avx512f"))) void SubAvx512(double* dst,
+                                                   const double* src,
+                                                   std::size_t n) {
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm512_storeu_pd(dst + i, _mm512_sub_pd(_mm512_loadu_pd(dst + i),
+                                            _mm512_loadu_pd(src + i)));
+  }
+  if (i < n) {
+    const __mmask8 m = static_cast<__mmask8>((1u << (n - i)) - 1);
+    _mm512_mask_storeu_pd(dst + i, m,
+                          _mm512_sub_pd(_mm512_maskz_loadu_pd(m, dst + i),
+                                        _mm512_maskz_loadu_pd(m, src + i)));
+  }
+}
+
+__attribute__((target("avx512f"))) void ScaleAvx512(double* dst, double alpha,
+                                                     std::size_t n) {
+  const __m512d va = _mm512_set1_pd(alpha);
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm512_storeu_pd(dst + i, _mm512_mul_pd(_mm512_loadu_pd(dst + i), va));
+  }
+  if (i < n) {
+    const __mmask8 m = static_cast<__mmask8>((1u << (n - i)) - 1);
+    _mm512_mask_storeu_pd(dst + i, m,
+                          _mm512_mul_pd(_mm512_maskz_loadu_pd(m, dst + i), va));
+  }
+}
+
+__attribute__((target("avx512f"))) void AxpyAvx512(double* dst, double alpha,
+                                                    const double* src,
+                                                    std::size_t n) {
+  const __m512d va = _mm512_set1_pd(alpha);
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm512_storeu_pd(dst + i, _mm512_fmadd_pd(va, _mm512_loadu_pd(src + i),
+                                              _mm512_loadu_pd(dst + i)));
+  }
+  if (i < n) {
+    const __mmask8 m = static_cast<__mmask8>((1u << (n - i)) - 1);
+    _mm512_mask_storeu_pd(
+        dst + i, m,
+        _mm512_fmadd_pd(va, _mm512_maskz_loadu_pd(m, src + i),
+                        _mm512_maskz_loadu_pd(m, dst + i)));
+  }
+}
+
+__attribute__((target("avx512f"))) bool EqualAvx512(const double* a,
+                                                     const double* b,
+                                                     std::size_t n,
+                                                     double eps) {
+  const __m512d veps = _mm512_set1_pd(eps);
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    const __m512d diff =
+        _mm512_sub_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i));
+    if (_mm512_cmp_pd_mask(_mm512_abs_pd(diff), veps, _CMP_LE_OQ) != 0xFF)
+      return false;
+  }
+  if (i < n) {
+    const __mmask8 m = static_cast<__mmask8>((1u << (n - i)) - 1);
+    const __m512d diff = _mm512_sub_pd(_mm512_maskz_loadu_pd(m, a + i),
+                                       _mm512_maskz_loadu_pd(m, b + i));
+    if (_mm512_mask_cmp_pd_mask(m, _mm512_abs_pd(diff), veps, _CMP_LE_OQ) != m)
+      return false;
+  }
+  return true;
+}
+
+constexpr Kernels kAvx512 = {"avx512",    AddAvx512,  SubAvx512,
+                             ScaleAvx512, AxpyAvx512, EqualAvx512};
+
+#endif  // S21_SIMD_X86
+
+// Выбор наиболее широкого набора инструкций, поддерживаемого процессором
+const Kernels& Select() noexcept {
+#if S21_SIMD_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) return kAvx512;
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    return kAvx2;
+  if (__builtin_cpu_supports("sse2")) return kSse2;
+#endif
+  return kScalar<double>;
+}
+
+}  // namespace
+
+template <>
+const Kernels& Active<double>() noexcept {
+  static const Kernels& kernels = Select();
+  return kernels;
+}
+
+template <>
+const Kernels& Scalar<double>() noexcept {
+  return kScalar<double>;
+}
+
+template <>
+std::vector<const Kernels*> Available<double>() {
+  std::vector<const Kernels*> sets = {&kScalar<double>};
+#if S21_SIMD_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("sse2")) sets.push_back(&kSse2);
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    sets.push_back(&kAvx2);
+  if (__builtin_cpu_supports("avx512f")) sets.push_back(&kAvx512);
+#endif
+  return sets;
+}
+
+#define S21_DEFINE(T)                                  \
+  template <>                                          \
+  const BasicKernels<T>& Active<T>() noexcept {        \
+    return kAuto<T>;                                   \
+  }                                                    \
+  template <>                                          \
+  const BasicKernels<T>& Scalar<T>() noexcept {        \
+    return kScalar<T>;                                 \
+  }                                                    \
+  template <>                                          \
+  std::vector<const BasicKernels<T>*> Available<T>() { \
+    return {&kScalar<T>, &kAuto<T>};                   \
+  }
+S21_DEFINE(float)
+S21_DEFINE(long double)
+S21_DEFINE(std::complex<float>)
+S21_DEFINE(std::complex<double>)
+#undef S21_DEFINE
+
+}  // namespace simd
+}  // namespace s21
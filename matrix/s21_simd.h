@@ -0,0 +1,57 @@
+#ifndef S21_SIMD_H
+#define S21_SIMD_H
+
+#include <cstddef>
+#include <vector>
+
+#include "s21_element_traits.h"
+
+namespace s21 {
+namespace simd {
+
+// Набор поэлементных ядер для непрерывных массивов из n элементов типа T
+template <class T>
+struct BasicKernels {
+  const char* name;  // Название набора инструкций
+  void (*add)(T* dst, const T* src, std::size_t n);  // dst += src
+  void (*sub)(T* dst, const T* src, std::size_t n);  // dst -= src
+  void (*scale)(T* dst, T alpha, std::size_t n);  // dst *= alpha
+  void (*axpy)(T* dst, T alpha, const T* src,
+               std::size_t n);  // dst += alpha * src
+  bool (*equal)(const T* a, const T* b, std::size_t n,
+                RealOf<T> eps);  // |a - b| <= eps для всех элементов
+};
+
+using Kernels = BasicKernels<double>;
+
+// Ядра, выбранные по CPUID при первом обращении. Для double — AVX-512,
+// AVX2+FMA, SSE2 или скалярная реализация; для остальных типов — циклы,
+// векторизованные компилятором в вариантах под AVX-512, AVX2 и базовый
+// набор (float помещает в регистр вдвое больше элементов, чем double)
+template <class T = double>
+const BasicKernels<T>& Active() noexcept;
+
+// Скалярная реализация, доступная на любой платформе
+template <class T = double>
+const BasicKernels<T>& Scalar() noexcept;
+
+// Все наборы, которые может выполнить процессор, от скалярного до
+// выбранного Active(); нужны для проверки наборов, не выбранных на этой
+// машине
+template <class T = double>
+std::vector<const BasicKernels<T>*> Available();
+
+#define S21_DECLARE(T)                                 \
+  template <>                                          \
+  const BasicKernels<T>& Active<T>() noexcept;         \
+  template <>                                          \
+  const BasicKernels<T>& Scalar<T>() noexcept;         \
+  template <>                                          \
+  std::vector<const BasicKernels<T>*> Available<T>();
+S21_MATRIX_ELEMENT_TYPES(S21_DECLARE)
+#undef S21_DECLARE
+
+}  // namespace simd
+}  // namespace s21
+
+#endif  // S21_SIMD_H
@@ -0,0 +1,36 @@
+#ifndef S21_SOLVE_H
+#define S21_SOLVE_H
+
+#include "s21_cholesky.h"
+#include "s21_lu.h"
+#include "s21_qr.h"
+
+// Метод решения системы A * X = B
+enum class S21SolveMethod {
+  kLU,        // Квадратная невырожденная A (s21_lu.h)
+  kCholesky,  // Эрмитова положительно определённая A (s21_cholesky.h)
+  kQR,        // A m x n, m >= n: наименьшие квадраты (s21_qr.h)
+};
+
+namespace s21 {
+
+// Решение A * X = B для всех столбцов B одним разложением A. Для
+// многократного решения с той же A разложение (LU, Cholesky, QR) следует
+// построить один раз и вызывать его solve
+template <class T>
+Matrix<T> Solve(const Matrix<T>& a, const Matrix<T>& b,
+                S21SolveMethod method = S21SolveMethod::kLU) {
+  switch (method) {
+    case S21SolveMethod::kCholesky:
+      return Cholesky<T>(a).solve(b);
+    case S21SolveMethod::kQR:
+      return QR<T>(a).solve(b);
+    case S21SolveMethod::kLU:
+      break;
+  }
+  return LU<T>(a).solve(b);
+}
+
+}  // namespace s21
+
+#endif  // S21_SOLVE_H
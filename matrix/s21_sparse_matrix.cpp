@@ -0,0 +1,426 @@
+#include "s21_sparse_matrix.h"
+
+#include <climits>
+#include <cmath>
+
+#include "s21_simd.h"
+#include "s21_thread_pool.h"
+
+namespace {
+
+// Проверка, что количество ненулевых элементов помещается в индексы int
+void CheckNonZeros(std::size_t count) {
+  if (count > static_cast<std::size_t>(INT_MAX))
+    throw std::length_error("Too many non-zero elements");
+}
+
+// Размер отрезка строк на задачу пула: у каждой задачи свои рабочие массивы
+// на cols элементов, поэтому отрезков не больше восьми на поток
+int RowGrain(int rows) {
+  const int threads = S21ThreadPool::instance().getThreadCount();
+  return std::max(64, rows / (8 * threads));
+}
+
+}  // namespace
+
+// Нулевая матрица rows x cols без ненулевых элементов
+S21SparseMatrix::S21SparseMatrix(int rows, int cols)
+    : rows_(rows), cols_(cols) {
+  if (rows <= 0 || cols <= 0) throw std::invalid_argument("Zero matrix");
+  rowPtr_.assign(static_cast<std::size_t>(rows) + 1, 0);
+}
+
+// Матрица из готовых массивов CSR с проверкой их согласованности
+S21SparseMatrix::S21SparseMatrix(int rows, int cols,
+                                 std::vector<int> rowPointers,
+                                 std::vector<int> colIndices,
+                                 std::vector<double> values)
+    : rows_(rows),
+      cols_(cols),
+      rowPtr_(std::move(rowPointers)),
+      colInd_(std::move(colIndices)),
+      values_(std::move(values)) {
+  if (rows <= 0 || cols <= 0) throw std::invalid_argument("Zero matrix");
+  if (rowPtr_.size() != static_cast<std::size_t>(rows) + 1 ||
+      rowPtr_.front() != 0 || colInd_.size() != values_.size() ||
+      static_cast<std::size_t>(rowPtr_.back()) != values_.size())
+    throw std::invalid_argument("Inconsistent CSR arrays");
+  for (auto i = 0; i < rows_; ++i) {
+    if (rowPtr_[i] > rowPtr_[i + 1])
+      throw std::invalid_argument("Inconsistent CSR arrays");
+    for (auto p = rowPtr_[i]; p < rowPtr_[i + 1]; ++p) {
+      if (colInd_[p] < 0 || colInd_[p] >= cols_ ||
+          (p > rowPtr_[i] && colInd_[p] <= colInd_[p - 1]))
+        throw std::invalid_argument("Unsorted or invalid CSR column index");
+    }
+  }
+}
+
+// Сжатие плотной матрицы: подсчёт элементов по строкам, затем заполнение
+S21SparseMatrix::S21SparseMatrix(const S21Matrix& dense, double tolerance)
+    : S21SparseMatrix(dense.getRows(), dense.getCols()) {
+  const double* data = dense.data();
+  const std::ptrdiff_t stride = dense.stride();
+  for (auto i = 0; i < rows_; ++i) {
+    int count = 0;
+    for (auto j = 0; j < cols_; ++j) {
+      if (std::fabs(data[i * stride + j]) > tolerance) ++count;
+    }
+    rowPtr_[i + 1] = rowPtr_[i] + count;
+    CheckNonZeros(static_cast<std::size_t>(rowPtr_[i]) + count);
+  }
+  colInd_.resize(rowPtr_.back());
+  values_.resize(rowPtr_.back());
+  for (auto i = 0, p = 0; i < rows_; ++i) {
+    for (auto j = 0; j < cols_; ++j) {
+      const double value = data[i * stride + j];
+      if (std::fabs(value) > tolerance) {
+        colInd_[p] = j;
+        values_[p++] = value;
+      }
+    }
+  }
+}
+
+// Построение из списка координат: сортировка по строкам и столбцам и
+// суммирование повторов; нулевые суммы не сохраняются
+S21SparseMatrix S21SparseMatrix::fromTriplets(int rows, int cols,
+                                              std::vector<Triplet> triplets) {
+  S21SparseMatrix result(rows, cols);
+  for (const auto& t : triplets) {
+    if (t.row < 0 || t.row >= rows || t.col < 0 || t.col >= cols)
+      throw std::out_of_range("Index out of range");
+  }
+  CheckNonZeros(triplets.size());
+  std::sort(triplets.begin(), triplets.end(),
+            [](const Triplet& a, const Triplet& b) {
+              return a.row != b.row ? a.row < b.row : a.col < b.col;
+            });
+
+  for (std::size_t k = 0; k < triplets.size();) {
+    const Triplet& t = triplets[k];
+    double sum = 0.;
+    for (; k < triplets.size() && triplets[k].row == t.row &&
+           triplets[k].col == t.col;
+         ++k)
+      sum += triplets[k].value;
+    if (sum == 0.) continue;
+    result.colInd_.push_back(t.col);
+    result.values_.push_back(sum);
+    ++result.rowPtr_[t.row + 1];
+  }
+  for (auto i = 0; i < rows; ++i) result.rowPtr_[i + 1] += result.rowPtr_[i];
+  return result;
+}
+
+// Развёртывание в плотную матрицу
+S21Matrix S21SparseMatrix::toDense() const {
+  S21Matrix result(rows_, cols_);
+  for (auto i = 0; i < rows_; ++i) {
+    double* dst =
+        result.data() + static_cast<std::ptrdiff_t>(i) * result.stride();
+    for (auto p = rowPtr_[i]; p < rowPtr_[i + 1]; ++p)
+      dst[colInd_[p]] = values_[p];
+  }
+  return result;
+}
+
+// Элемент (i, j): двоичный поиск столбца среди ненулевых элементов строки
+double S21SparseMatrix::getElem(int i, int j) const {
+  if (i < 0 || i >= rows_ || j < 0 || j >= cols_)
+    throw std::out_of_range("Index out of range");
+  const auto first = colInd_.begin() + rowPtr_[i];
+  const auto last = colInd_.begin() + rowPtr_[i + 1];
+  const auto it = std::lower_bound(first, last, j);
+  return it != last && *it == j ? values_[it - colInd_.begin()] : 0.;
+}
+
+// Сравнение с точностью EPS; отсутствующий элемент считается нулём
+bool S21SparseMatrix::EqMatrix(const S21SparseMatrix& other) const {
+  if (rows_ != other.rows_ || cols_ != other.cols_) return false;
+  for (auto i = 0; i < rows_; ++i) {
+    auto p = rowPtr_[i];
+    auto q = other.rowPtr_[i];
+    while (p < rowPtr_[i + 1] || q < other.rowPtr_[i + 1]) {
+      double a = 0.;
+      double b = 0.;
+      if (q == other.rowPtr_[i + 1] ||
+          (p < rowPtr_[i + 1] && colInd_[p] < other.colInd_[q])) {
+        a = values_[p++];
+      } else if (p == rowPtr_[i + 1] || other.colInd_[q] < colInd_[p]) {
+        b = other.values_[q++];
+      } else {
+        a = values_[p++];
+        b = other.values_[q++];
+      }
+      if (!(std::fabs(a - b) <= EPS)) return false;
+    }
+  }
+  return true;
+}
+
+// Слияние отсортированных строк двух матриц с операцией op над парой
+// значений (отсутствующее значение — ноль); нулевые результаты отбрасываются
+template <class Op>
+void S21SparseMatrix::merge(const S21SparseMatrix& other, Op op) {
+  if (rows_ != other.rows_ || cols_ != other.cols_)
+    throw std::invalid_argument("Different matrix dimensions");
+  CheckNonZeros(nonZeros() + other.nonZeros());
+
+  std::vector<int> rowPtr(rowPtr_.size(), 0);
+  std::vector<int> colInd;
+  std::vector<double> values;
+  colInd.reserve(nonZeros() + other.nonZeros());
+  values.reserve(nonZeros() + other.nonZeros());
+  for (auto i = 0; i < rows_; ++i) {
+    auto p = rowPtr_[i];
+    auto q = other.rowPtr_[i];
+    while (p < rowPtr_[i + 1] || q < other.rowPtr_[i + 1]) {
+      int col;
+      double value;
+      if (q == other.rowPtr_[i + 1] ||
+          (p < rowPtr_[i + 1] && colInd_[p] < other.colInd_[q])) {
+        col = colInd_[p];
+        value = op(values_[p++], 0.);
+      } else if (p == rowPtr_[i + 1] || other.colInd_[q] < colInd_[p]) {
+        col = other.colInd_[q];
+        value = op(0., other.values_[q++]);
+      } else {
+        col = colInd_[p];
+        value = op(values_[p++], other.values_[q++]);
+      }
+      if (value != 0.) {
+        colInd.push_back(col);
+        values.push_back(value);
+      }
+    }
+    rowPtr[i + 1] = static_cast<int>(colInd.size());
+  }
+  rowPtr_ = std::move(rowPtr);
+  colInd_ = std::move(colInd);
+  values_ = std::move(values);
+}
+
+// Сложение разреженных матриц за O(nnz)
+void S21SparseMatrix::SumMatrix(const S21SparseMatrix& other) {
+  merge(other, [](double a, double b) { return a + b; });
+}
+
+// Вычитание разреженных матриц за O(nnz)
+void S21SparseMatrix::SubMatrix(const S21SparseMatrix& other) {
+  merge(other, [](double a, double b) { return a - b; });
+}
+
+// Умножение на число; умножение на ноль очищает структуру
+void S21SparseMatrix::MulNumber(const double num) {
+  if (num == 0.) {
+    std::fill(rowPtr_.begin(), rowPtr_.end(), 0);
+    colInd_.clear();
+    values_.clear();
+    return;
+  }
+  for (auto& value : values_) value *= num;
+}
+
+// Умножение разреженных матриц по Густавсону. Символьный проход считает
+// различные столбцы каждой строки результата, числовой накапливает строку в
+// плотном массиве и сортирует её столбцы. Строки независимы и делятся между
+// потоками; время пропорционально количеству умножений, а не rows * cols
+void S21SparseMatrix::MulMatrix(const S21SparseMatrix& other) {
+  if (cols_ != other.rows_)
+    throw std::invalid_argument(
+        "The number of columns in the first matrix is not equal to the rows in "
+        "second matrix");
+
+  const int n = other.cols_;
+  auto& pool = S21ThreadPool::instance();
+  const int grain = RowGrain(rows_);
+
+  std::vector<std::size_t> counts(static_cast<std::size_t>(rows_) + 1, 0);
+  pool.parallelFor(rows_, grain, [&](int begin, int end) {
+    std::vector<int> marker(n, -1);
+    for (auto i = begin; i < end; ++i) {
+      std::size_t count = 0;
+      for (auto p = rowPtr_[i]; p < rowPtr_[i + 1]; ++p) {
+        const int k = colInd_[p];
+        for (auto q = other.rowPtr_[k]; q < other.rowPtr_[k + 1]; ++q) {
+          if (marker[other.colInd_[q]] != i) {
+            marker[other.colInd_[q]] = i;
+            ++count;
+          }
+        }
+      }
+      counts[i + 1] = count;
+    }
+  });
+  for (auto i = 0; i < rows_; ++i) counts[i + 1] += counts[i];
+  CheckNonZeros(counts.back());
+
+  std::vector<int> rowPtr(counts.begin(), counts.end());
+  std::vector<int> colInd(counts.back());
+  std::vector<double> values(counts.back());
+  pool.parallelFor(rows_, grain, [&](int begin, int end) {
+    std::vector<double> acc(n);
+    std::vector<int> marker(n, -1);
+    for (auto i = begin; i < end; ++i) {
+      const int start = rowPtr[i];
+      int pos = start;
+      for (auto p = rowPtr_[i]; p < rowPtr_[i + 1]; ++p) {
+        const int k = colInd_[p];
+        const double a = values_[p];
+        for (auto q = other.rowPtr_[k]; q < other.rowPtr_[k + 1]; ++q) {
+          const int j = other.colInd_[q];
+          if (marker[j] != i) {
+            marker[j] = i;
+            colInd[pos++] = j;
+            acc[j] = a * other.values_[q];
+          } else {
+            acc[j] += a * other.values_[q];
+          }
+        }
+      }
+      std::sort(colInd.begin() + start, colInd.begin() + pos);
+      for (auto t = start; t < pos; ++t) values[t] = acc[colInd[t]];
+    }
+  });
+
+  cols_ = n;
+  rowPtr_ = std::move(rowPtr);
+  colInd_ = std::move(colInd);
+  values_ = std::move(values);
+}
+
+// Транспонирование сортировкой подсчётом по номерам столбцов; строки
+// обходятся по возрастанию, поэтому столбцы результата уже упорядочены
+S21SparseMatrix S21SparseMatrix::Transpose() const {
+  S21SparseMatrix result(cols_, rows_);
+  for (const int col : colInd_) ++result.rowPtr_[col + 1];
+  for (auto j = 0; j < cols_; ++j) result.rowPtr_[j + 1] += result.rowPtr_[j];
+
+  result.colInd_.resize(nonZeros());
+  result.values_.resize(nonZeros());
+  std::vector<int> next(result.rowPtr_.begin(), result.rowPtr_.end() - 1);
+  for (auto i = 0; i < rows_; ++i) {
+    for (auto p = rowPtr_[i]; p < rowPtr_[i + 1]; ++p) {
+      const int dst = next[colInd_[p]]++;
+      result.colInd_[dst] = i;
+      result.values_[dst] = values_[p];
+    }
+  }
+  return result;
+}
+
+S21SparseMatrix S21SparseMatrix::operator+(
+    const S21SparseMatrix& other) const {
+  S21SparseMatrix result(*this);
+  result.SumMatrix(other);
+  return result;
+}
+
+S21SparseMatrix S21SparseMatrix::operator-(
+    const S21SparseMatrix& other) const {
+  S21SparseMatrix result(*this);
+  result.SubMatrix(other);
+  return result;
+}
+
+S21SparseMatrix S21SparseMatrix::operator*(const double num) const {
+  S21SparseMatrix result(*this);
+  result.MulNumber(num);
+  return result;
+}
+
+S21SparseMatrix S21SparseMatrix::operator*(
+    const S21SparseMatrix& other) const {
+  S21SparseMatrix result(*this);
+  result.MulMatrix(other);
+  return result;
+}
+
+// Разреженная матрица на плотную: строка результата — сумма строк плотной
+// матрицы с весами из строки разреженной, каждая через векторный axpy
+S21Matrix S21SparseMatrix::operator*(const S21Matrix& dense) const {
+  if (cols_ != dense.getRows())
+    throw std::invalid_argument(
+        "The number of columns in the first matrix is not equal to the rows in "
+        "second matrix");
+
+  S21Matrix result(rows_, dense.getCols());
+  const auto& simd = s21::simd::Active();
+  const std::size_t n = static_cast<std::size_t>(dense.getCols());
+  auto& pool = S21ThreadPool::instance();
+  pool.forEachRowBlock(rows_, n, [&](int begin, int end) {
+    for (auto i = begin; i < end; ++i) {
+      double* dst =
+          result.data() + static_cast<std::ptrdiff_t>(i) * result.stride();
+      for (auto p = rowPtr_[i]; p < rowPtr_[i + 1]; ++p) {
+        simd.axpy(dst, values_[p],
+                  dense.data() +
+                      static_cast<std::ptrdiff_t>(colInd_[p]) * dense.stride(),
+                  n);
+      }
+    }
+  });
+  return result;
+}
+
+S21SparseMatrix& S21SparseMatrix::operator+=(const S21SparseMatrix& other) {
+  SumMatrix(other);
+  return *this;
+}
+
+S21SparseMatrix& S21SparseMatrix::operator-=(const S21SparseMatrix& other) {
+  SubMatrix(other);
+  return *this;
+}
+
+S21SparseMatrix& S21SparseMatrix::operator*=(const double num) {
+  MulNumber(num);
+  return *this;
+}
+
+S21SparseMatrix& S21SparseMatrix::operator*=(const S21SparseMatrix& other) {
+  MulMatrix(other);
+  return *this;
+}
+
+bool S21SparseMatrix::operator==(const S21SparseMatrix& other) const {
+  return EqMatrix(other);
+}
+
+// Плотная матрица на разреженную: каждый ненулевой элемент плотной строки
+// добавляет к строке результата взвешенную строку разреженной матрицы
+S21Matrix operator*(const S21Matrix& dense, const S21SparseMatrix& sparse) {
+  if (dense.getCols() != sparse.getRows())
+    throw std::invalid_argument(
+        "The number of columns in the first matrix is not equal to the rows in "
+        "second matrix");
+
+  S21Matrix result(dense.getRows(), sparse.getCols());
+  const auto& rowPtr = sparse.rowPointers();
+  const auto& colInd = sparse.colIndices();
+  const auto& values = sparse.values();
+  auto& pool = S21ThreadPool::instance();
+  pool.forEachRowBlock(
+      result.getRows(), static_cast<std::size_t>(dense.getCols()),
+      [&](int begin, int end) {
+        for (auto i = begin; i < end; ++i) {
+          const double* src =
+              dense.data() + static_cast<std::ptrdiff_t>(i) * dense.stride();
+          double* dst =
+              result.data() + static_cast<std::ptrdiff_t>(i) * result.stride();
+          for (auto k = 0; k < sparse.getRows(); ++k) {
+            if (src[k] == 0.) continue;
+            for (auto p = rowPtr[k]; p < rowPtr[k + 1]; ++p)
+              dst[colInd[p]] += src[k] * values[p];
+          }
+        }
+      });
+  return result;
+}
+
+// CSC хранится как CSR транспонированной матрицы
+S21CscMatrix::S21CscMatrix(const S21SparseMatrix& csr)
+    : transposed_(csr.Transpose()) {}
+
+S21SparseMatrix S21CscMatrix::toCsr() const { return transposed_.Transpose(); }
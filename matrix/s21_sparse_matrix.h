@@ -0,0 +1,108 @@
+#ifndef S21_SPARSE_MATRIX_H
+#define S21_SPARSE_MATRIX_H
+
+#include <cstddef>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+// Разреженная матрица в формате CSR: ненулевые элементы строки i лежат в
+// values()[rowPointers()[i] .. rowPointers()[i + 1]) с номерами столбцов
+// colIndices(), отсортированными по возрастанию. Память и время операций
+// пропорциональны количеству ненулевых элементов nnz, а не rows * cols.
+// Индексы хранятся в int, поэтому nnz не больше INT_MAX
+class S21SparseMatrix {
+ public:
+  // Элемент для построения матрицы из списка координат
+  struct Triplet {
+    int row;
+    int col;
+    double value;
+  };
+
+  // Конструкторы
+  S21SparseMatrix(int rows, int cols);  // Нулевая матрица
+  S21SparseMatrix(int rows, int cols, std::vector<int> rowPointers,
+                  std::vector<int> colIndices,
+                  std::vector<double> values);  // Готовые массивы CSR
+  explicit S21SparseMatrix(
+      const S21Matrix& dense,
+      double tolerance = 0.);  // Элементы с модулем больше tolerance
+  static S21SparseMatrix fromTriplets(
+      int rows, int cols,
+      std::vector<Triplet> triplets);  // Повторные координаты суммируются
+
+  // Преобразование в плотную матрицу
+  S21Matrix toDense() const;
+
+  // Размеры и хранилище
+  int getRows() const noexcept { return rows_; }
+  int getCols() const noexcept { return cols_; }
+  std::size_t nonZeros() const noexcept { return values_.size(); }
+  const std::vector<int>& rowPointers() const noexcept { return rowPtr_; }
+  const std::vector<int>& colIndices() const noexcept { return colInd_; }
+  const std::vector<double>& values() const noexcept { return values_; }
+  double getElem(int i, int j) const;  // Двоичный поиск в строке
+
+  // Операции над матрицами
+  bool EqMatrix(const S21SparseMatrix& other) const;  // С точностью EPS
+  void SumMatrix(const S21SparseMatrix& other);  // Слияние строк
+  void SubMatrix(const S21SparseMatrix& other);
+  void MulNumber(const double num);
+  void MulMatrix(const S21SparseMatrix& other);  // Алгоритм Густавсона
+  S21SparseMatrix Transpose() const;  // Сортировка подсчётом, O(nnz)
+
+  // Операторы
+  S21SparseMatrix operator+(const S21SparseMatrix& other) const;
+  S21SparseMatrix operator-(const S21SparseMatrix& other) const;
+  S21SparseMatrix operator*(const double num) const;
+  S21SparseMatrix operator*(const S21SparseMatrix& other) const;
+  S21Matrix operator*(const S21Matrix& dense) const;  // Разреженная на плотную
+  S21SparseMatrix& operator+=(const S21SparseMatrix& other);
+  S21SparseMatrix& operator-=(const S21SparseMatrix& other);
+  S21SparseMatrix& operator*=(const double num);
+  S21SparseMatrix& operator*=(const S21SparseMatrix& other);
+  bool operator==(const S21SparseMatrix& other) const;
+
+ private:
+  template <class Op>
+  void merge(const S21SparseMatrix& other, Op op);  // Поэлементная операция
+
+  int rows_;
+  int cols_;
+  std::vector<int> rowPtr_;     // rows_ + 1 смещений начала строк
+  std::vector<int> colInd_;     // Номера столбцов ненулевых элементов
+  std::vector<double> values_;  // Значения ненулевых элементов
+};
+
+// Плотная матрица на разреженную
+S21Matrix operator*(const S21Matrix& dense, const S21SparseMatrix& sparse);
+
+// Та же матрица в формате CSC: столбец j лежит в
+// values()[colPointers()[j] .. colPointers()[j + 1]) с номерами строк
+// rowIndices(). Массивы CSC матрицы A совпадают с массивами CSR матрицы A^T,
+// поэтому преобразование в обе стороны — транспонирование за O(nnz)
+class S21CscMatrix {
+ public:
+  explicit S21CscMatrix(const S21SparseMatrix& csr);
+  S21SparseMatrix toCsr() const;
+
+  int getRows() const noexcept { return transposed_.getCols(); }
+  int getCols() const noexcept { return transposed_.getRows(); }
+  std::size_t nonZeros() const noexcept { return transposed_.nonZeros(); }
+  const std::vector<int>& colPointers() const noexcept {
+    return transposed_.rowPointers();
+  }
+  const std::vector<int>& rowIndices() const noexcept {
+    return transposed_.colIndices();
+  }
+  const std::vector<double>& values() const noexcept {
+    return transposed_.values();
+  }
+  double getElem(int i, int j) const { return transposed_.getElem(j, i); }
+
+ private:
+  S21SparseMatrix transposed_;  // CSR транспонированной матрицы
+};
+
+#endif  // S21_SPARSE_MATRIX_H
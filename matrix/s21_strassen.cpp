@@ -0,0 +1,202 @@
+#include "s21_strassen.h"
+
+#include <algorithm>
+#include <atomic>
+#include <complex>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "s21_gemm.h"
+
+namespace s21 {
+namespace strassen {
+
+namespace {
+
+std::atomic<int> crossover{kDefaultCrossover};
+
+// D = A + B для блоков h x w
+template <class T>
+void Add(int h, int w, const T* a, std::ptrdiff_t lda, const T* b,
+         std::ptrdiff_t ldb, T* d, std::ptrdiff_t ldd) {
+  for (int i = 0; i < h; ++i) {
+    for (int j = 0; j < w; ++j)
+      d[i * ldd + j] = a[i * lda + j] + b[i * ldb + j];
+  }
+}
+
+// D = A - B для блоков h x w
+template <class T>
+void Sub(int h, int w, const T* a, std::ptrdiff_t lda, const T* b,
+         std::ptrdiff_t ldb, T* d, std::ptrdiff_t ldd) {
+  for (int i = 0; i < h; ++i) {
+    for (int j = 0; j < w; ++j)
+      d[i * ldd + j] = a[i * lda + j] - b[i * ldb + j];
+  }
+}
+
+// C = A * B классическим блочным GEMM
+template <class T>
+void Classic(int m, int n, int k, const T* a, std::ptrdiff_t lda, const T* b,
+             std::ptrdiff_t ldb, T* c, std::ptrdiff_t ldc) {
+  for (int i = 0; i < m; ++i) std::fill(c + i * ldc, c + i * ldc + n, T());
+  gemm::MulAdd(m, n, k, T(1), a, lda, 1, b, ldb, 1, c, ldc);
+}
+
+// Размер временных блоков X и Y на всех уровнях рекурсии
+std::size_t WorkspaceSize(int m, int n, int k, int levels) {
+  std::size_t size = 0;
+  for (; levels > 0; --levels) {
+    m /= 2;
+    n /= 2;
+    k /= 2;
+    size += static_cast<std::size_t>(m) * std::max(k, n) +
+            static_cast<std::size_t>(k) * n;
+  }
+  return size;
+}
+
+// Один уровень схемы Штрассена-Винограда с двумя временными блоками
+// (Boyer, Dumas, Pernet, Zhou, 2009). Все размеры делятся на 2^levels
+template <class T>
+void Recurse(int m, int n, int k, const T* a, std::ptrdiff_t lda, const T* b,
+             std::ptrdiff_t ldb, T* c, std::ptrdiff_t ldc, int levels,
+             T* work) {
+  if (levels == 0) {
+    Classic(m, n, k, a, lda, b, ldb, c, ldc);
+    return;
+  }
+
+  const int h = m / 2;
+  const int w = n / 2;
+  const int d = k / 2;
+  const T* a11 = a;
+  const T* a12 = a + d;
+  const T* a21 = a + h * lda;
+  const T* a22 = a21 + d;
+  const T* b11 = b;
+  const T* b12 = b + w;
+  const T* b21 = b + d * ldb;
+  const T* b22 = b21 + w;
+  T* c11 = c;
+  T* c12 = c + w;
+  T* c21 = c + h * ldc;
+  T* c22 = c21 + w;
+
+  const std::ptrdiff_t ldx = std::max(d, w);
+  const std::ptrdiff_t ldy = w;
+  T* x = work;
+  T* y = x + h * ldx;
+  T* next = y + d * ldy;
+  const int lower = levels - 1;
+
+  Sub(h, d, a11, lda, a21, lda, x, ldx);                  // S3 = A11 - A21
+  Sub(d, w, b22, ldb, b12, ldb, y, ldy);                  // T3 = B22 - B12
+  Recurse(h, w, d, x, ldx, y, ldy, c21, ldc, lower, next);  // P7 = S3 * T3
+  Add(h, d, a21, lda, a22, lda, x, ldx);                  // S1 = A21 + A22
+  Sub(d, w, b12, ldb, b11, ldb, y, ldy);                  // T1 = B12 - B11
+  Recurse(h, w, d, x, ldx, y, ldy, c22, ldc, lower, next);  // P5 = S1 * T1
+  Sub(h, d, x, ldx, a11, lda, x, ldx);                    // S2 = S1 - A11
+  Sub(d, w, b22, ldb, y, ldy, y, ldy);                    // T2 = B22 - T1
+  Recurse(h, w, d, x, ldx, y, ldy, c12, ldc, lower, next);  // P6 = S2 * T2
+  Sub(h, d, a12, lda, x, ldx, x, ldx);                    // S4 = A12 - S2
+  Recurse(h, w, d, x, ldx, b22, ldb, c11, ldc, lower, next);  // P3 = S4 * B22
+  Recurse(h, w, d, a11, lda, b11, ldb, x, ldx, lower, next);  // P1 = A11 * B11
+  Add(h, w, x, ldx, c12, ldc, c12, ldc);                  // U2 = P1 + P6
+  Add(h, w, c12, ldc, c21, ldc, c21, ldc);                // U3 = U2 + P7
+  Add(h, w, c12, ldc, c22, ldc, c12, ldc);                // U4 = U2 + P5
+  Add(h, w, c21, ldc, c22, ldc, c22, ldc);                // U7 = U3 + P5
+  Add(h, w, c12, ldc, c11, ldc, c12, ldc);                // U5 = U4 + P3
+  Sub(d, w, y, ldy, b21, ldb, y, ldy);                    // T4 = T2 - B21
+  Recurse(h, w, d, a22, lda, y, ldy, c11, ldc, lower, next);  // P4 = A22 * T4
+  Sub(h, w, c21, ldc, c11, ldc, c21, ldc);                // U6 = U3 - P4
+  Recurse(h, w, d, a12, lda, b21, ldb, c11, ldc, lower, next);  // P2
+  Add(h, w, x, ldx, c11, ldc, c11, ldc);                  // U1 = P1 + P2
+}
+
+// Копия блока rows x cols в плотный буфер paddedRows x paddedCols с нулями
+// в дополнении
+template <class T>
+void CopyPadded(int rows, int cols, const T* src, std::ptrdiff_t lds,
+                int paddedRows, int paddedCols, T* dst) {
+  std::fill(dst, dst + static_cast<std::size_t>(paddedRows) * paddedCols, T());
+  for (int i = 0; i < rows; ++i) {
+    std::copy(src + i * lds, src + i * lds + cols, dst + i * paddedCols);
+  }
+}
+
+}  // namespace
+
+void SetCrossover(int value) {
+  if (value < 16)
+    throw std::invalid_argument("The Strassen crossover must be at least 16");
+  crossover = value;
+}
+
+int GetCrossover() noexcept { return crossover; }
+
+template <class T>
+void Multiply(int m, int n, int k, const T* a, std::ptrdiff_t lda, const T* b,
+              std::ptrdiff_t ldb, T* c, std::ptrdiff_t ldc) {
+  if (m <= 0 || n <= 0) return;
+
+  // Глубина рекурсии: пока наименьший размер больше порога
+  const int limit = crossover;
+  int levels = 0;
+  for (int size = std::min({m, n, k}); size > limit; size = (size + 1) / 2) {
+    ++levels;
+  }
+  if (levels == 0) {
+    Classic(m, n, k, a, lda, b, ldb, c, ldc);
+    return;
+  }
+
+  const int step = 1 << levels;
+  const int pm = (m + step - 1) / step * step;
+  const int pn = (n + step - 1) / step * step;
+  const int pk = (k + step - 1) / step * step;
+  const std::size_t workspace = WorkspaceSize(pm, pn, pk, levels);
+  const bool padded = pm != m || pn != n || pk != k;
+  const std::size_t sizeA = padded ? static_cast<std::size_t>(pm) * pk : 0;
+  const std::size_t sizeB = padded ? static_cast<std::size_t>(pk) * pn : 0;
+  const std::size_t sizeC = padded ? static_cast<std::size_t>(pm) * pn : 0;
+  const std::size_t total = sizeA + sizeB + sizeC + workspace;
+
+  // Малый буфер переиспользуется потоком, большой освобождается по выходе
+  thread_local std::vector<T> cached;
+  std::unique_ptr<T[]> scoped;
+  T* buffer;
+  if (total * sizeof(T) <= kMaxCachedBytes) {
+    if (cached.size() < total) cached.resize(total);
+    buffer = cached.data();
+  } else {
+    scoped.reset(new T[total]);
+    buffer = scoped.get();
+  }
+
+  if (!padded) {
+    Recurse(m, n, k, a, lda, b, ldb, c, ldc, levels, buffer);
+    return;
+  }
+
+  // Нечётные размеры: вычисление в дополненных нулями копиях
+  T* pa = buffer;
+  T* pb = pa + sizeA;
+  T* pc = pb + sizeB;
+  CopyPadded(m, k, a, lda, pm, pk, pa);
+  CopyPadded(k, n, b, ldb, pk, pn, pb);
+  Recurse(pm, pn, pk, pa, pk, pb, pn, pc, pn, levels, pc + sizeC);
+  for (int i = 0; i < m; ++i) {
+    std::copy(pc + i * pn, pc + i * pn + n, c + i * ldc);
+  }
+}
+
+#define S21_INSTANTIATE(T)                                                  \
+  template void Multiply(int, int, int, const T*, std::ptrdiff_t, const T*, \
+                         std::ptrdiff_t, T*, std::ptrdiff_t);
+S21_MATRIX_ELEMENT_TYPES(S21_INSTANTIATE)
+#undef S21_INSTANTIATE
+
+}  // namespace strassen
+}  // namespace s21
@@ -0,0 +1,47 @@
+#ifndef S21_STRASSEN_H
+#define S21_STRASSEN_H
+
+#include <cstddef>
+
+#include "s21_element_traits.h"
+
+namespace s21 {
+namespace strassen {
+
+// Порог перехода к классическому GEMM: рекурсия продолжается, пока все
+// размеры подзадачи больше порога
+constexpr int kDefaultCrossover = 512;
+
+void SetCrossover(int crossover);  // Изменение порога (не меньше 16)
+int GetCrossover() noexcept;       // Текущий порог
+
+// Наибольший буфер, который поток сохраняет между вызовами Multiply (в
+// байтах); буфер большего размера освобождается по выходе из вызова
+constexpr std::size_t kMaxCachedBytes = std::size_t(64) << 20;
+
+// C(m x n) = A(m x k) * B(k x n) по схеме Штрассена-Винограда: 7 умножений
+// половинного размера и 15 сложений на уровень. Матрицы хранятся по
+// строкам с шагами lda, ldb, ldc; C не должна пересекаться с A и B.
+// Нечётные размеры дополняются нулями до кратных 2^глубина.
+//
+// Память: временные блоки всех уровней занимают около 2/3 * m * n
+// элементов (для квадратных матриц); если размеры не кратны 2^глубина, к
+// ним добавляются дополненные копии A, B и C, и пик доходит примерно до
+// 3.7 * n^2 элементов (около 500 МБ для double при n = 4097). Буфер до
+// kMaxCachedBytes остаётся у потока и переиспользуется следующими
+// вызовами, больший выделяется на время вызова.
+//
+// Погрешность: в отличие от классического умножения ошибка растёт с
+// глубиной рекурсии. Для элементов, ограниченных по модулю a и b,
+// отклонение от классического результата не превышает
+// 1e-15 * k * a * b * 12^глубина (глубина 3 при n = 4096 и пороге 512)
+// для double; для других типов множитель 1e-15 заменяется их машинным
+// эпсилон. Инстанцирован для типов S21_MATRIX_ELEMENT_TYPES
+template <class T>
+void Multiply(int m, int n, int k, const T* a, std::ptrdiff_t lda, const T* b,
+              std::ptrdiff_t ldb, T* c, std::ptrdiff_t ldc);
+
+}  // namespace strassen
+}  // namespace s21
+
+#endif  // S21_STRASSEN_H
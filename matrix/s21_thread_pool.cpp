@@ -0,0 +1,192 @@
+#include "s21_thread_pool.h"
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+namespace {
+
+thread_local int tLimit = 0;  // Ограничение S21ThreadLimit, 0 — нет
+thread_local bool tInsideTask = false;  // Поток выполняет задачу пула
+
+int HardwareThreads() {
+  return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+}  // namespace
+
+// Параллельный цикл: исполнители разбирают отрезки через общий счётчик, так
+// что нагрузка выравнивается и без перераспределения задач
+struct S21ThreadPool::Job {
+  const std::function<void(int, int)>* body = nullptr;
+  int count = 0;
+  int grain = 1;
+  int chunks = 0;
+  std::atomic<int> next{0};    // Следующий необработанный отрезок
+  std::atomic<int> active{0};  // Незавершённые исполнители
+  std::mutex errorMutex;       // Защита error
+  std::exception_ptr error;    // Первое исключение из body
+};
+
+// Глобальный пул библиотеки
+S21ThreadPool& S21ThreadPool::instance() {
+  static S21ThreadPool pool;
+  return pool;
+}
+
+S21ThreadPool::S21ThreadPool() : threadCount_(HardwareThreads()) {}
+
+S21ThreadPool::~S21ThreadPool() { stop(); }
+
+// Изменение размера пула; рабочие потоки перезапустятся при следующей задаче
+void S21ThreadPool::setThreadCount(int count) {
+  if (count < 0)
+    throw std::invalid_argument("The number of threads must not be negative");
+
+  stop();
+  threadCount_ = count ? count : HardwareThreads();
+}
+
+// Количество потоков для операций текущего потока
+int S21ThreadPool::getThreadCount() const noexcept {
+  const int count = threadCount_;
+  return tLimit > 0 ? std::min(tLimit, count) : count;
+}
+
+void S21ThreadPool::parallelFor(int count, int grain,
+                                const std::function<void(int, int)>& body) {
+  if (count <= 0) return;
+  grain = std::max(grain, 1);
+  const int chunks = (count - 1) / grain + 1;
+  const int runners = std::min(getThreadCount(), chunks);
+  if (runners <= 1 || tInsideTask) {
+    body(0, count);
+    return;
+  }
+
+  start();
+
+  Job job;
+  job.body = &body;
+  job.count = count;
+  job.grain = grain;
+  job.chunks = chunks;
+  job.active = runners;
+
+  const int queues = static_cast<int>(queues_.size());
+  for (int i = 0; i < runners - 1; ++i) {
+    Queue& queue = *queues_[nextQueue_++ % queues];
+    {
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      queue.tasks.push_back(&job);
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ++pending_;
+    }
+    wake_.notify_one();
+  }
+
+  // Вызывающий поток сам выступает исполнителем, а затем помогает с любыми
+  // задачами пула, пока не завершатся все исполнители его цикла
+  runJob(job);
+  --job.active;
+  while (job.active.load(std::memory_order_acquire) > 0) {
+    if (!runOneTask(-1)) std::this_thread::yield();
+  }
+
+  if (job.error) std::rethrow_exception(job.error);
+}
+
+// Запуск рабочих потоков, если они ещё не запущены
+void S21ThreadPool::start() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!workers_.empty()) return;
+
+  const int workers = std::max(threadCount_.load() - 1, 1);
+  stopping_ = false;
+  queues_.clear();
+  for (int i = 0; i < workers; ++i) {
+    queues_.push_back(std::make_unique<Queue>());
+  }
+  for (int i = 0; i < workers; ++i) {
+    workers_.emplace_back(&S21ThreadPool::workerLoop, this, i);
+  }
+}
+
+// Остановка рабочих потоков после того, как они разберут свои очереди
+void S21ThreadPool::stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (workers_.empty()) return;
+    stopping_ = true;
+  }
+  wake_.notify_all();
+  for (auto& worker : workers_) worker.join();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  workers_.clear();
+}
+
+void S21ThreadPool::workerLoop(int index) {
+  while (true) {
+    if (runOneTask(index)) continue;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    wake_.wait(lock, [this] { return stopping_ || pending_ > 0; });
+    if (stopping_ && pending_ == 0) return;
+  }
+}
+
+// Задача берётся с конца своей очереди, а при её пустоте — с начала чужих
+bool S21ThreadPool::runOneTask(int index) {
+  const int queues = static_cast<int>(queues_.size());
+  Job* job = nullptr;
+  for (int i = 0; i < queues && !job; ++i) {
+    const int victim = index < 0 ? i : (index + i) % queues;
+    Queue& queue = *queues_[victim];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) continue;
+    if (victim == index) {
+      job = queue.tasks.back();
+      queue.tasks.pop_back();
+    } else {
+      job = queue.tasks.front();
+      queue.tasks.pop_front();
+    }
+  }
+  if (!job) return false;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    --pending_;
+  }
+  runJob(*job);
+  job->active.fetch_sub(1, std::memory_order_release);
+  return true;
+}
+
+// Обработка отрезков задачи до их исчерпания
+void S21ThreadPool::runJob(Job& job) {
+  const bool wasInside = tInsideTask;
+  tInsideTask = true;
+  for (int chunk = job.next++; chunk < job.chunks; chunk = job.next++) {
+    const int begin = chunk * job.grain;
+    try {
+      (*job.body)(begin, std::min(begin + job.grain, job.count));
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(job.errorMutex);
+      if (!job.error) job.error = std::current_exception();
+      job.next = job.chunks;  // Оставшиеся отрезки пропускаются
+    }
+  }
+  tInsideTask = wasInside;
+}
+
+S21ThreadLimit::S21ThreadLimit(int count) : previous_(tLimit) {
+  if (count < 0)
+    throw std::invalid_argument("The number of threads must not be negative");
+  tLimit = count;
+}
+
+S21ThreadLimit::~S21ThreadLimit() { tLimit = previous_; }
@@ -0,0 +1,93 @@
+#ifndef S21_THREAD_POOL_H
+#define S21_THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Общий для библиотеки пул потоков. Рабочие потоки запускаются при первой
+// параллельной задаче, у каждого своя очередь, а простаивающие потоки
+// забирают задачи из чужих очередей
+class S21ThreadPool {
+ public:
+  static S21ThreadPool& instance();  // Глобальный пул библиотеки
+
+  S21ThreadPool(const S21ThreadPool&) = delete;
+  S21ThreadPool& operator=(const S21ThreadPool&) = delete;
+  ~S21ThreadPool();
+
+  // Количество потоков, включая вызывающий; 0 — по числу ядер. Не должно
+  // вызываться одновременно с параллельными операциями
+  void setThreadCount(int count);
+  int getThreadCount() const noexcept;  // С учётом ограничения S21ThreadLimit
+
+  // Вызов body(begin, end) для отрезков [0, count) длиной не больше grain.
+  // Вызывающий поток участвует в работе и возвращается после завершения всех
+  // отрезков; первое выброшенное исключение передаётся вызывающему. Вызовы
+  // изнутри задачи пула выполняются последовательно
+  void parallelFor(int count, int grain,
+                   const std::function<void(int, int)>& body);
+
+  // Поэлементные проходы по буферам больше kParallelElements делятся между
+  // потоками блоками строк примерно по kChunkElements элементов
+  static constexpr std::size_t kParallelElements = std::size_t(1) << 18;
+  static constexpr std::size_t kChunkElements = std::size_t(1) << 15;
+
+  // Вызов body(begin, end) для блоков строк матрицы из rows строк по
+  // rowSize элементов; малые матрицы обходятся в вызывающем потоке
+  template <class Body>
+  void forEachRowBlock(int rows, std::size_t rowSize, const Body& body) {
+    if (rows * rowSize < kParallelElements) {
+      body(0, rows);
+      return;
+    }
+    const int grain =
+        static_cast<int>(std::max<std::size_t>(1, kChunkElements / rowSize));
+    parallelFor(rows, grain, body);
+  }
+
+ private:
+  struct Job;
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Job*> tasks;
+  };
+
+  S21ThreadPool();
+  void start();  // Запуск рабочих потоков
+  void stop();   // Остановка и ожидание рабочих потоков
+  void workerLoop(int index);  // Цикл рабочего потока
+  bool runOneTask(int index);  // Выполнение своей или украденной задачи
+  static void runJob(Job& job);  // Обработка отрезков задачи
+
+  std::vector<std::unique_ptr<Queue>> queues_;  // Очереди рабочих потоков
+  std::vector<std::thread> workers_;            // Рабочие потоки
+  std::mutex mutex_;              // Защита ожидания и запуска
+  std::condition_variable wake_;  // Пробуждение простаивающих потоков
+  int pending_ = 0;               // Задачи в очередях (под mutex_)
+  bool stopping_ = false;         // Запрос на остановку (под mutex_)
+  std::atomic<int> threadCount_;  // Заданное количество потоков
+  std::atomic<unsigned> nextQueue_{0};  // Очередь для следующей задачи
+};
+
+// Ограничение числа потоков для операций в текущем потоке на время жизни
+// объекта, например для одного вызова MulMatrix; 0 снимает ограничение
+class S21ThreadLimit {
+ public:
+  explicit S21ThreadLimit(int count);
+  S21ThreadLimit(const S21ThreadLimit&) = delete;
+  S21ThreadLimit& operator=(const S21ThreadLimit&) = delete;
+  ~S21ThreadLimit();
+
+ private:
+  int previous_;  // Предыдущее ограничение
+};
+
+#endif  // S21_THREAD_POOL_H
@@ -0,0 +1,238 @@
+#include "s21_transpose.h"
+
+#include <algorithm>
+#include <complex>
+#include <type_traits>
+
+#include "s21_thread_pool.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define S21_TRANSPOSE_X86 1
+#include <immintrin.h>
+#else
+#define S21_TRANSPOSE_X86 0
+#endif
+
+namespace s21 {
+namespace transpose {
+
+namespace {
+
+// Транспонирование плитки kTile x kTile: dst[j][i] = src[i][j]
+template <class T>
+using TileKernel = void (*)(const T* src, std::ptrdiff_t lds, T* dst,
+                            std::ptrdiff_t ldd);
+
+template <class T>
+void TileScalar(const T* src, std::ptrdiff_t lds, T* dst, std::ptrdiff_t ldd) {
+  for (int i = 0; i < kTile; ++i) {
+    for (int j = 0; j < kTile; ++j) dst[j * ldd + i] = src[i * lds + j];
+  }
+}
+
+#if S21_TRANSPOSE_X86
+
+// Плитка 8 x 8 как четыре блока 4 x 4: чередование пар строк внутри
+// 128-битных половин и обмен половинами
+__attribute__((target("avx"))) void TileAvx(const double* src,
+                                            std::ptrdiff_t lds, double* dst,
+                                            std::ptrdiff_t ldd) {
+  for (int bi = 0; bi < kTile; bi += 4) {
+    for (int bj = 0; bj < kTile; bj += 4) {
+      const double* s = src + bi * lds + bj;
+      double* d = dst + bj * ldd + bi;
+      const __m256d r0 = _mm256_loadu_pd(s);
+      const __m256d r1 = _mm256_loadu_pd(s + lds);
+      const __m256d r2 = _mm256_loadu_pd(s + 2 * lds);
+      const __m256d r3 = _mm256_loadu_pd(s + 3 * lds);
+      const __m256d t0 = _mm256_unpacklo_pd(r0, r1);  // a0 b0 a2 b2
+      const __m256d t1 = _mm256_unpackhi_pd(r0, r1);  // a1 b1 a3 b3
+      const __m256d t2 = _mm256_unpacklo_pd(r2, r3);  // c0 d0 c2 d2
+      const __m256d t3 = _mm256_unpackhi_pd(r2, r3);  // c1 d1 c3 d3
+      _mm256_storeu_pd(d, _mm256_permute2f128_pd(t0, t2, 0x20));
+      _mm256_storeu_pd(d + ldd, _mm256_permute2f128_pd(t1, t3, 0x20));
+      _mm256_storeu_pd(d + 2 * ldd, _mm256_permute2f128_pd(t0, t2, 0x31));
+      _mm256_storeu_pd(d + 3 * ldd, _mm256_permute2f128_pd(t1, t3, 0x31));
+    }
+  }
+}
+
+// Плитка 8 x 8 целиком в регистрах: чередование пар строк, затем две
+// перестановки 128-битных четвертей. Варианты с нулевой маской 0xFF дают те
+// же инструкции, но не опираются на _mm512_undefined_pd, на котором GCC 12
+// выдаёт ложное предупреждение -Wuninitialized
+__attribute__((target("avx512f"))) void TileAvx512(const double* src,
+                                                   std::ptrdiff_t lds,
+                                                   double* dst,
+                                                   std::ptrdiff_t ldd) {
+  constexpr __mmask8 kAll = 0xFF;
+  __m512d r[kTile];
+  for (int i = 0; i < kTile; ++i) r[i] = _mm512_loadu_pd(src + i * lds);
+
+  // Чётные и нечётные столбцы каждой пары строк
+  __m512d t[kTile];
+  for (int i = 0; i < kTile; i += 2) {
+    t[i] = _mm512_maskz_unpacklo_pd(kAll, r[i], r[i + 1]);
+    t[i + 1] = _mm512_maskz_unpackhi_pd(kAll, r[i], r[i + 1]);
+  }
+
+  // u[0..3] — столбцы {0,4}, {1,5}, {2,6}, {3,7} строк 0-3, u[4..7] — 4-7
+  __m512d u[kTile];
+  for (int h = 0; h < kTile; h += 4) {
+    u[h] = _mm512_maskz_shuffle_f64x2(kAll, t[h], t[h + 2], 0x88);
+    u[h + 1] = _mm512_maskz_shuffle_f64x2(kAll, t[h + 1], t[h + 3], 0x88);
+    u[h + 2] = _mm512_maskz_shuffle_f64x2(kAll, t[h], t[h + 2], 0xDD);
+    u[h + 3] = _mm512_maskz_shuffle_f64x2(kAll, t[h + 1], t[h + 3], 0xDD);
+  }
+
+  for (int j = 0; j < 4; ++j) {
+    _mm512_storeu_pd(dst + j * ldd,
+                     _mm512_maskz_shuffle_f64x2(kAll, u[j], u[j + 4], 0x88));
+    _mm512_storeu_pd(dst + (j + 4) * ldd,
+                     _mm512_maskz_shuffle_f64x2(kAll, u[j], u[j + 4], 0xDD));
+  }
+}
+
+#endif  // S21_TRANSPOSE_X86
+
+// Выбор наиболее широкого набора инструкций, поддерживаемого процессором
+TileKernel<double> Select() noexcept {
+#if S21_TRANSPOSE_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) return TileAvx512;
+  if (__builtin_cpu_supports("avx")) return TileAvx;
+#endif
+  return TileScalar<double>;
+}
+
+template <class T>
+TileKernel<T> Active() noexcept {
+  if constexpr (std::is_same_v<T, double>) {
+    static const TileKernel<double> kernel = Select();
+    return kernel;
+  } else {
+    return TileScalar<T>;
+  }
+}
+
+// Лист рекурсии: целые плитки ядром, края поэлементно
+template <class T>
+void Leaf(int rows, int cols, const T* src, std::ptrdiff_t lds, T* dst,
+          std::ptrdiff_t ldd, TileKernel<T> tile) {
+  int i = 0;
+  for (; i + kTile <= rows; i += kTile) {
+    int j = 0;
+    for (; j + kTile <= cols; j += kTile) {
+      tile(src + i * lds + j, lds, dst + j * ldd + i, ldd);
+    }
+    for (; j < cols; ++j) {
+      for (int r = i; r < i + kTile; ++r) dst[j * ldd + r] = src[r * lds + j];
+    }
+  }
+  for (; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) dst[j * ldd + i] = src[i * lds + j];
+  }
+}
+
+// Деление большего размера пополам с границей, кратной плитке
+template <class T>
+void Recurse(int rows, int cols, const T* src, std::ptrdiff_t lds, T* dst,
+             std::ptrdiff_t ldd, TileKernel<T> tile) {
+  if (rows <= kLeaf && cols <= kLeaf) {
+    Leaf(rows, cols, src, lds, dst, ldd, tile);
+  } else if (rows >= cols) {
+    const int half = (rows / 2 + kTile - 1) / kTile * kTile;
+    Recurse(half, cols, src, lds, dst, ldd, tile);
+    Recurse(rows - half, cols, src + half * lds, lds, dst + half, ldd, tile);
+  } else {
+    const int half = (cols / 2 + kTile - 1) / kTile * kTile;
+    Recurse(rows, half, src, lds, dst, ldd, tile);
+    Recurse(rows, cols - half, src + half, lds, dst + half * ldd, ldd, tile);
+  }
+}
+
+// Обмен блока h x w с началом (r, c) и симметричного ему блока (c, r).
+// Для r == c блок диагональный и транспонируется сам в себя
+template <class T>
+void SwapTiles(int r, int c, int h, int w, T* a, std::ptrdiff_t lda,
+               TileKernel<T> tile) {
+  T* upper = a + r * lda + c;
+  T* lower = a + c * lda + r;
+  if (h == kTile && w == kTile) {
+    alignas(64) T tmp[kTile * kTile];
+    for (int i = 0; i < kTile; ++i)
+      std::copy(upper + i * lda, upper + i * lda + kTile, tmp + i * kTile);
+    if (r != c) tile(lower, lda, upper, lda);
+    tile(tmp, kTile, lower, lda);
+    return;
+  }
+  for (int i = 0; i < h; ++i) {
+    for (int j = r == c ? i + 1 : 0; j < w; ++j)
+      std::swap(upper[i * lda + j], lower[j * lda + i]);
+  }
+}
+
+}  // namespace
+
+template <class T>
+void Transpose(int rows, int cols, const T* src, std::ptrdiff_t lds, T* dst,
+               std::ptrdiff_t ldd) {
+  const TileKernel<T> tile = Active<T>();
+  auto& pool = S21ThreadPool::instance();
+  if (static_cast<std::size_t>(rows) * cols <
+          S21ThreadPool::kParallelElements ||
+      pool.getThreadCount() == 1) {
+    Recurse(rows, cols, src, lds, dst, ldd, tile);
+    return;
+  }
+
+  // Полосы столбцов источника пишут в непересекающиеся строки результата
+  const int strips = (cols + kStrip - 1) / kStrip;
+  pool.parallelFor(strips, 1, [&](int begin, int end) {
+    for (int s = begin; s < end; ++s) {
+      const int c = s * kStrip;
+      Recurse(rows, std::min(kStrip, cols - c), src + c, lds, dst + c * ldd,
+              ldd, tile);
+    }
+  });
+}
+
+template <class T>
+void TransposeInPlace(int n, T* a, std::ptrdiff_t lda) {
+  const TileKernel<T> tile = Active<T>();
+  const int blocks = (n + kLeaf - 1) / kLeaf;
+
+  // Задача bi обменивает пары блоков (bi, bj) и (bj, bi) для bj >= bi, так
+  // что разные задачи не касаются одних и тех же элементов
+  auto body = [&](int begin, int end) {
+    for (int bi = begin; bi < end; ++bi) {
+      const int rowEnd = std::min(n, (bi + 1) * kLeaf);
+      for (int bj = bi; bj < blocks; ++bj) {
+        const int colEnd = std::min(n, (bj + 1) * kLeaf);
+        for (int r = bi * kLeaf; r < rowEnd; r += kTile) {
+          for (int c = bi == bj ? r : bj * kLeaf; c < colEnd; c += kTile) {
+            SwapTiles(r, c, std::min(kTile, n - r), std::min(kTile, n - c), a,
+                      lda, tile);
+          }
+        }
+      }
+    }
+  };
+
+  auto& pool = S21ThreadPool::instance();
+  if (static_cast<std::size_t>(n) * n < S21ThreadPool::kParallelElements) {
+    body(0, blocks);
+  } else {
+    pool.parallelFor(blocks, 1, body);
+  }
+}
+
+#define S21_INSTANTIATE(T)                                        \
+  template void Transpose(int, int, const T*, std::ptrdiff_t, T*, \
+                          std::ptrdiff_t);                        \
+  template void TransposeInPlace(int, T*, std::ptrdiff_t);
+S21_MATRIX_ELEMENT_TYPES(S21_INSTANTIATE)
+#undef S21_INSTANTIATE
+
+}  // namespace transpose
+}  // namespace s21
@@ -0,0 +1,36 @@
+#ifndef S21_TRANSPOSE_H
+#define S21_TRANSPOSE_H
+
+#include <cstddef>
+
+#include "s21_element_traits.h"
+
+namespace s21 {
+namespace transpose {
+
+// Плитки 8 x 8 транспонируются в регистрах (AVX-512 целиком, AVX четырьмя
+// блоками 4 x 4), а порядок обхода плиток задаётся рекурсивным делением
+// большего размера пополам до листа kLeaf x kLeaf. Такой обход не зависит
+// от размеров кэшей и TLB: на каждом уровне иерархии памяти найдётся
+// уровень рекурсии, блоки которого в него помещаются
+constexpr int kTile = 8;
+constexpr int kLeaf = 32;
+constexpr int kStrip = 256;  // Ширина полосы столбцов на задачу пула
+
+// dst(cols x rows) = src(rows x cols)^T; строки src идут с шагом lds,
+// строки dst — с шагом ldd. Буферы не должны пересекаться. Векторные ядра
+// плиток есть для double, остальные типы S21_MATRIX_ELEMENT_TYPES
+// обходятся тем же порядком с поэлементной плиткой
+template <class T>
+void Transpose(int rows, int cols, const T* src, std::ptrdiff_t lds, T* dst,
+               std::ptrdiff_t ldd);
+
+// Транспонирование квадратной матрицы n x n на месте попарным обменом
+// симметричных плиток
+template <class T>
+void TransposeInPlace(int n, T* a, std::ptrdiff_t lda);
+
+}  // namespace transpose
+}  // namespace s21
+
+#endif  // S21_TRANSPOSE_H
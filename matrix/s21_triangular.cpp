@@ -0,0 +1,73 @@
+#include "s21_triangular.h"
+
+#include <algorithm>
+#include <complex>
+
+#include "s21_gemm.h"
+#include "s21_simd.h"
+#include "s21_thread_pool.h"
+
+namespace s21 {
+namespace triangular {
+
+// Прямая подстановка по блокам строк сверху вниз. Если X нижнетреугольная,
+// то и решение такое же, и вклад и обработка ограничены столбцами [0, kEnd)
+template <class T>
+void SolveLower(int n, int m, const T* a, std::ptrdiff_t lda,
+                bool unitDiagonal, T* x, std::ptrdiff_t ldx, bool lowerRhs) {
+  const auto& simd = simd::Active<T>();
+  auto& pool = S21ThreadPool::instance();
+
+  for (int k = 0; k < n; k += kBlock) {
+    const int kEnd = std::min(k + kBlock, n);
+    const int cols = lowerRhs ? kEnd : m;
+    gemm::MulAdd(kEnd - k, lowerRhs ? k : m, k, T(-1), a + k * lda, lda, 1, x,
+                 ldx, 1, x + k * ldx, ldx);
+    pool.parallelFor(cols, kColumnGrain, [&](int begin, int end) {
+      for (int i = k; i < kEnd; ++i) {
+        for (int r = k; r < i; ++r) {
+          simd.axpy(x + i * ldx + begin, -a[i * lda + r],
+                    x + r * ldx + begin, end - begin);
+        }
+        if (!unitDiagonal) {
+          simd.scale(x + i * ldx + begin, T(1) / a[i * lda + i],
+                     end - begin);
+        }
+      }
+    });
+  }
+}
+
+// Обратная подстановка, блоки строк обходятся снизу вверх
+template <class T>
+void SolveUpper(int n, int m, const T* a, std::ptrdiff_t lda, T* x,
+                std::ptrdiff_t ldx) {
+  const auto& simd = simd::Active<T>();
+  auto& pool = S21ThreadPool::instance();
+
+  for (int kEnd = n; kEnd > 0; kEnd -= kBlock) {
+    const int k = std::max(kEnd - kBlock, 0);
+    gemm::MulAdd(kEnd - k, m, n - kEnd, T(-1), a + k * lda + kEnd, lda, 1,
+                 x + kEnd * ldx, ldx, 1, x + k * ldx, ldx);
+    pool.parallelFor(m, kColumnGrain, [&](int begin, int end) {
+      for (int i = kEnd - 1; i >= k; --i) {
+        for (int r = i + 1; r < kEnd; ++r) {
+          simd.axpy(x + i * ldx + begin, -a[i * lda + r],
+                    x + r * ldx + begin, end - begin);
+        }
+        simd.scale(x + i * ldx + begin, T(1) / a[i * lda + i], end - begin);
+      }
+    });
+  }
+}
+
+#define S21_INSTANTIATE(T)                                                \
+  template void SolveLower(int, int, const T*, std::ptrdiff_t, bool, T*, \
+                           std::ptrdiff_t, bool);                         \
+  template void SolveUpper(int, int, const T*, std::ptrdiff_t, T*,       \
+                           std::ptrdiff_t);
+S21_MATRIX_ELEMENT_TYPES(S21_INSTANTIATE)
+#undef S21_INSTANTIATE
+
+}  // namespace triangular
+}  // namespace s21
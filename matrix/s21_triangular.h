@@ -0,0 +1,36 @@
+#ifndef S21_TRIANGULAR_H
+#define S21_TRIANGULAR_H
+
+#include <cstddef>
+
+#include "s21_element_traits.h"
+
+namespace s21 {
+namespace triangular {
+
+// Размер блока строк: вклад уже найденных блоков вычитается одним вызовом
+// GEMM, а треугольник внутри блока обрабатывается построчно
+constexpr int kBlock = 64;
+// Ширина полосы столбцов правой части для одной задачи пула потоков
+constexpr int kColumnGrain = 256;
+
+// Решение L * Y = X на месте для m столбцов X (n x m, шаг строк ldx), где
+// L — нижний треугольник a (n x n, шаг строк lda). При unitDiagonal
+// диагональ L считается единичной и не читается. При lowerRhs X
+// нижнетреугольная с той же диагональю, что и L, поэтому столбцы правее
+// текущего блока не трогаются (обращение матрицы).
+// Инстанцирован для типов S21_MATRIX_ELEMENT_TYPES
+template <class T>
+void SolveLower(int n, int m, const T* a, std::ptrdiff_t lda,
+                bool unitDiagonal, T* x, std::ptrdiff_t ldx,
+                bool lowerRhs = false);
+
+// Решение U * Y = X на месте, где U — верхний треугольник a с диагональю
+template <class T>
+void SolveUpper(int n, int m, const T* a, std::ptrdiff_t lda, T* x,
+                std::ptrdiff_t ldx);
+
+}  // namespace triangular
+}  // namespace s21
+
+#endif  // S21_TRIANGULAR_H
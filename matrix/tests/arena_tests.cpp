@@ -0,0 +1,144 @@
+#include <memory_resource>
+#include <random>
+
+#include "../s21_scratch_arena.h"
+#include "tests.h"
+
+namespace {
+
+// Ресурс, считающий обращения к нему
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  int allocations = 0;
+  int deallocations = 0;
+
+ private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    ++allocations;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  void do_deallocate(void* p, std::size_t bytes,
+                     std::size_t alignment) override {
+    ++deallocations;
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+
+// Подмена ресурса по умолчанию на время теста
+class DefaultResourceGuard {
+ public:
+  explicit DefaultResourceGuard(std::pmr::memory_resource* resource)
+      : previous_(std::pmr::set_default_resource(resource)) {}
+  ~DefaultResourceGuard() { std::pmr::set_default_resource(previous_); }
+
+ private:
+  std::pmr::memory_resource* previous_;
+};
+
+S21Matrix Random(int rows, int cols, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> value(-1., 1.);
+  S21Matrix m(rows, cols);
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) m(i, j) = value(gen);
+  }
+  return m;
+}
+
+}  // namespace
+
+TEST(Arena, matrix_resource) {
+  CountingResource counting;
+  {
+    S21Matrix m(3, 3, &counting);
+    m(1, 2) = 5;
+    EXPECT_EQ(m.resource(), &counting);
+    EXPECT_EQ(counting.allocations, 1);
+
+    // Ресурс переходит вместе с буфером
+    S21Matrix moved(std::move(m));
+    EXPECT_EQ(moved.resource(), &counting);
+    S21Matrix other(2, 2);
+    other.swap(moved);
+    EXPECT_EQ(other.resource(), &counting);
+    EXPECT_EQ(moved.resource(), std::pmr::get_default_resource());
+
+    // Копии и результаты операций используют ресурс по умолчанию
+    const S21Matrix copy(other);
+    EXPECT_EQ(copy.resource(), std::pmr::get_default_resource());
+    EXPECT_EQ(S21Matrix(other + copy).resource(),
+              std::pmr::get_default_resource());
+    EXPECT_EQ(counting.allocations, 1);
+
+    // Присваивание копированием сохраняет ресурс приёмника
+    S21Matrix target(1, 1, &counting);
+    target = copy;
+    EXPECT_EQ(target.resource(), &counting);
+    EXPECT_EQ(target(1, 2), 5);
+    EXPECT_TRUE(S21Matrix(copy, &counting) == copy);
+  }
+  EXPECT_EQ(counting.deallocations, counting.allocations);
+}
+
+TEST(Arena, scratch_reuse) {
+  CountingResource upstream;
+  {
+    s21::ScratchArena arena(&upstream);
+    {
+      S21Matrix a(10, 10, &arena);
+      {
+        S21Matrix b(10, 10, &arena);
+        EXPECT_EQ(arena.liveAllocations(), 2u);
+      }
+      // Последнее выделение возвращено сразу и переиспользуется
+      S21Matrix c(10, 10, &arena);
+      EXPECT_EQ(upstream.allocations, 1);
+      { S21Matrix big(200, 200, &arena); }
+      EXPECT_EQ(upstream.allocations, 2);
+    }
+    // После освобождения всех выделений блоки объединяются в один
+    EXPECT_EQ(arena.liveAllocations(), 0u);
+    EXPECT_EQ(upstream.allocations, 3);
+    const std::size_t capacity = arena.capacity();
+    {
+      S21Matrix a(10, 10, &arena);
+      S21Matrix big(200, 200, &arena);
+    }
+    EXPECT_EQ(upstream.allocations, 3);
+    EXPECT_EQ(arena.capacity(), capacity);
+  }
+  EXPECT_EQ(upstream.deallocations, upstream.allocations);
+}
+
+TEST(Arena, no_default_allocations) {
+  const S21Matrix a = Random(6, 6, 1);
+  S21Matrix singular = Random(6, 6, 2);
+  for (int j = 0; j < 6; ++j) singular(5, j) = singular(4, j);
+  // Прогрев арены потока
+  S21Matrix(a).CalcComplements();
+  S21Matrix(singular).CalcComplements();
+
+  CountingResource counting;
+  DefaultResourceGuard guard(&counting);
+  S21Matrix(a).Determinant();
+  EXPECT_EQ(counting.allocations, 1);  // Только копия a
+
+  // Каждая операция выделяет только свой результат
+  S21Matrix m(a);
+  counting.allocations = 0;
+  m.Determinant();
+  EXPECT_EQ(counting.allocations, 0);
+  m.InverseMatrix();
+  EXPECT_EQ(counting.allocations, 1);
+  m.CalcComplements();
+  EXPECT_EQ(counting.allocations, 2);
+  S21Matrix s(singular);
+  counting.allocations = 0;
+  s.CalcComplements();
+  EXPECT_EQ(counting.allocations, 1);
+  EXPECT_EQ(s21::ScratchArena::local().liveAllocations(), 0u);
+}
@@ -0,0 +1,134 @@
+#include <random>
+#include <vector>
+
+#include "../s21_matrix_batch.h"
+#include "tests.h"
+
+namespace {
+
+// Набор из count случайных матриц с преобладающей диагональю
+S21MatrixBatch RandomBatch(int count, int rows, int cols, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> value(-1., 1.);
+  S21MatrixBatch batch(count, rows, cols);
+  for (int k = 0; k < count; ++k) {
+    for (int i = 0; i < rows; ++i) {
+      for (int j = 0; j < cols; ++j)
+        batch(k, i, j) = value(gen) + (i == j ? rows : 0);
+    }
+  }
+  return batch;
+}
+
+}  // namespace
+
+TEST(Batch, layout) {
+  S21MatrixBatch batch(11, 2, 3);
+  EXPECT_EQ(batch.size(), 11);
+  EXPECT_EQ(batch.getRows(), 2);
+  EXPECT_EQ(batch.getCols(), 3);
+  S21Matrix m(2, 3);
+  m.fillMatrixArr(std::vector<double>{1, 2, 3, 4, 5, 6}.data());
+  batch.set(9, m);
+  EXPECT_EQ(batch(9, 1, 2), 6.);
+  EXPECT_EQ(batch(8, 1, 2), 0.);
+  EXPECT_TRUE(batch.get(9) == m);
+  EXPECT_THROW(batch(11, 0, 0), std::out_of_range);
+  EXPECT_THROW(batch.set(0, S21Matrix(3, 2)), std::invalid_argument);
+  EXPECT_THROW(S21MatrixBatch(1, 0, 2), std::invalid_argument);
+  EXPECT_EQ(S21MatrixBatch(0, 3, 3).Determinant().size(), 0u);
+}
+
+TEST(Batch, multiply_matches_single) {
+  const S21MatrixBatch a = RandomBatch(37, 5, 7, 1);
+  const S21MatrixBatch b = RandomBatch(37, 7, 3, 2);
+  const S21MatrixBatch c = a * b;
+  ASSERT_EQ(c.getRows(), 5);
+  ASSERT_EQ(c.getCols(), 3);
+  for (int k = 0; k < 37; ++k) EXPECT_TRUE(c.get(k) == a.get(k) * b.get(k));
+  EXPECT_THROW(a * a, std::invalid_argument);
+  EXPECT_THROW(a * RandomBatch(36, 7, 3, 2), std::invalid_argument);
+}
+
+TEST(Batch, determinant_inverse_solve) {
+  for (int n : {1, 3, 4, 16}) {
+    const S21MatrixBatch a = RandomBatch(21, n, n, n);
+    const std::vector<double> det = a.Determinant();
+    const S21MatrixBatch inverse = a.InverseMatrix();
+    const S21MatrixBatch rhs = RandomBatch(21, n, 2, 100 + n);
+    const S21MatrixBatch x = a.Solve(rhs);
+    for (int k = 0; k < 21; ++k) {
+      const S21Matrix single = a.get(k);
+      EXPECT_NEAR(det[k], S21Matrix(single).Determinant(),
+                  1e-12 * std::abs(det[k]));
+      EXPECT_TRUE(inverse.get(k) == S21Matrix(single).InverseMatrix());
+      EXPECT_TRUE(single * x.get(k) == rhs.get(k));
+    }
+  }
+}
+
+TEST(Batch, pivoting_per_matrix) {
+  // Разным матрицам пачки нужны разные перестановки строк
+  S21MatrixBatch a(3, 2, 2);
+  const double values[3][4] = {{0, 1, 1, 0}, {2, 1, 1, 3}, {1e-20, 1, 1, 1}};
+  for (int k = 0; k < 3; ++k) {
+    S21Matrix m(2, 2);
+    m.fillMatrixArr(values[k]);
+    a.set(k, m);
+  }
+  const std::vector<double> det = a.Determinant();
+  EXPECT_DOUBLE_EQ(det[0], -1.);
+  EXPECT_DOUBLE_EQ(det[1], 5.);
+  EXPECT_NEAR(det[2], -1., 1e-15);
+  EXPECT_TRUE(a * a.InverseMatrix() == [] {
+    S21MatrixBatch identity(3, 2, 2);
+    for (int k = 0; k < 3; ++k) identity(k, 0, 0) = identity(k, 1, 1) = 1.;
+    return identity;
+  }());
+}
+
+TEST(Batch, badly_scaled) {
+  // Вырожденность не зависит от разброса масштабов элементов
+  S21MatrixBatch a(2, 2, 2);
+  a(0, 0, 0) = 1e10;
+  a(0, 1, 1) = 1.;
+  a(1, 0, 0) = 1.;
+  a(1, 1, 1) = 1e-12;
+  a(1, 0, 1) = 1e8;
+  const std::vector<double> det = a.Determinant();
+  EXPECT_EQ(det[0], 1e10);
+  EXPECT_EQ(det[1], 1e-12);
+  const S21MatrixBatch inverse = a.InverseMatrix();
+  EXPECT_EQ(inverse(0, 0, 0), 1e-10);
+  EXPECT_EQ(inverse(1, 1, 1), 1e12);
+  S21MatrixBatch rhs(2, 2, 1);
+  rhs(0, 0, 0) = 1e10;
+  rhs(0, 1, 0) = 2.;
+  const S21MatrixBatch x = a.Solve(rhs);
+  EXPECT_DOUBLE_EQ(x(0, 0, 0), 1.);
+  EXPECT_DOUBLE_EQ(x(0, 1, 0), 2.);
+}
+
+TEST(Batch, singular) {
+  // Строка, кратная другой степенью двойки, даёт точно нулевой ведущий
+  // элемент
+  S21MatrixBatch a = RandomBatch(10, 3, 3, 5);
+  for (int j = 0; j < 3; ++j) a(7, 2, j) = 2. * a(7, 0, j);
+  const std::vector<double> det = a.Determinant();
+  EXPECT_EQ(det[7], 0.);
+  EXPECT_NE(det[6], 0.);
+  EXPECT_THROW(a.InverseMatrix(), std::invalid_argument);
+  EXPECT_THROW(a.Solve(RandomBatch(10, 3, 1, 6)), std::invalid_argument);
+  EXPECT_THROW(a.Solve(RandomBatch(10, 2, 1, 6)), std::invalid_argument);
+  EXPECT_THROW(RandomBatch(2, 2, 3, 1).Determinant(), std::invalid_argument);
+}
+
+TEST(Batch, float_elements) {
+  s21::MatrixBatch<float> a(20, 4, 4);
+  for (int k = 0; k < 20; ++k) {
+    for (int i = 0; i < 4; ++i) a(k, i, i) = float(k + 1);
+  }
+  const std::vector<float> det = a.Determinant();
+  EXPECT_FLOAT_EQ(det[19], 20.f * 20.f * 20.f * 20.f);
+  EXPECT_FLOAT_EQ(a.InverseMatrix()(3, 2, 2), 0.25f);
+}
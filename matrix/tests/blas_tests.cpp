@@ -0,0 +1,163 @@
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <random>
+
+#include "../s21_blas.h"
+#include "tests.h"
+
+namespace {
+
+template <class T>
+s21::Matrix<T> Random(int rows, int cols, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> value(-1., 1.);
+  s21::Matrix<T> m(rows, cols);
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      if constexpr (s21::ElementTraits<T>::kComplex) {
+        m(i, j) = T(value(gen), value(gen));
+      } else {
+        m(i, j) = T(value(gen));
+      }
+    }
+  }
+  return m;
+}
+
+// alpha * op(A) * op(B) + beta * C по определению
+template <class T>
+s21::Matrix<T> Reference(s21::blas::Scalar<T> alpha,
+                         const s21::blas::View<T>& a,
+                         const s21::blas::View<T>& b,
+                         s21::blas::Scalar<T> beta, const s21::Matrix<T>& c) {
+  s21::Matrix<T> result(c.getRows(), c.getCols());
+  for (int i = 0; i < c.getRows(); ++i) {
+    for (int j = 0; j < c.getCols(); ++j) {
+      T sum = T();
+      for (int p = 0; p < a.getCols(); ++p) sum += a(i, p) * b(p, j);
+      result(i, j) = alpha * sum + beta * c(i, j);
+    }
+  }
+  return result;
+}
+
+template <class T>
+double MaxDiff(const s21::Matrix<T>& a, const s21::Matrix<T>& b) {
+  double diff = 0;
+  for (int i = 0; i < a.getRows(); ++i) {
+    for (int j = 0; j < a.getCols(); ++j)
+      diff = std::max(diff, double(std::abs(a(i, j) - b(i, j))));
+  }
+  return diff;
+}
+
+}  // namespace
+
+TEST(Blas, gemm_alpha_beta_transpose) {
+  // Размеры больше блоков GEMM, чтобы beta применялась только к первому
+  // блоку глубины и к каждой плитке
+  const S21Matrix a = Random<double>(300, 140, 1);
+  const S21Matrix b = Random<double>(300, 270, 2);
+  const S21Matrix c = Random<double>(140, 270, 3);
+  S21Matrix result(c);
+  s21::blas::Gemm(2., a, b, -0.5, result, S21Transpose::kTranspose);
+  EXPECT_LT(MaxDiff(result, Reference(2., a.TransposeView(), b, -0.5, c)),
+            1e-10);
+
+  const S21Matrix bt = Random<double>(270, 300, 4);
+  result = c;
+  s21::blas::Gemm(1., a, bt, 1., result, S21Transpose::kTranspose,
+                  S21Transpose::kTranspose);
+  EXPECT_LT(MaxDiff(result, Reference(1., a.TransposeView(),
+                                      bt.TransposeView(), 1., c)),
+            1e-10);
+
+  // При beta == 0 прежние значения C не читаются
+  S21Matrix nan(140, 270);
+  nan.fillMatrix(std::numeric_limits<double>::quiet_NaN());
+  s21::blas::Gemm(1., a, b, 0., nan, S21Transpose::kTranspose);
+  EXPECT_TRUE(nan == S21Matrix(a).Transpose() * b);
+
+  // alpha == 0: только масштабирование C
+  result = c;
+  s21::blas::Gemm(0., a, b, 3., result, S21Transpose::kTranspose);
+  EXPECT_LT(MaxDiff(result, S21Matrix(c * 3.)), 1e-12);
+
+  EXPECT_THROW(s21::blas::Gemm(1., a, b, 0., result), std::invalid_argument);
+  EXPECT_THROW(s21::blas::Gemm(1., a, b, 0., nan, S21Transpose::kNone,
+                               S21Transpose::kTranspose),
+               std::invalid_argument);
+}
+
+TEST(Blas, gemm_aliasing_and_types) {
+  // Результат совпадает с множителем
+  S21Matrix a = Random<double>(20, 20, 5);
+  const S21Matrix copy(a);
+  s21::blas::Gemm(1., a, a, 1., a);
+  EXPECT_LT(MaxDiff(a, Reference(1., copy, copy, 1., copy)), 1e-12);
+
+  using C = std::complex<double>;
+  const s21::Matrix<C> x = Random<C>(9, 7, 6);
+  const s21::Matrix<C> y = Random<C>(7, 11, 7);
+  s21::Matrix<C> z = Random<C>(9, 11, 8);
+  const s21::Matrix<C> z0(z);
+  s21::blas::Gemm(C(1, 2), x, y, C(0, -1), z);
+  EXPECT_LT(MaxDiff(z, Reference(C(1, 2), x, y, C(0, -1), z0)), 1e-12);
+
+  // alpha и beta приводятся к типу элементов результата
+  const s21::Matrix<float> f = Random<float>(5, 5, 9);
+  s21::Matrix<float> g(5, 5);
+  s21::blas::Gemm(2., f, f, 0, g);
+  EXPECT_LT(MaxDiff(g, Reference(2.f, f, f, 0.f, g)), 1e-5);
+}
+
+TEST(Blas, gemv) {
+  S21Matrix a = Random<double>(600, 300, 10);
+  const S21Matrix x = Random<double>(300, 1, 11);
+  const S21Matrix y = Random<double>(600, 1, 12);
+
+  // Непрерывные строки A, x и y — столбцы с шагом строки матрицы
+  S21Matrix result(y);
+  s21::blas::Gemv(1.5, a, x, 2., result);
+  EXPECT_LT(MaxDiff(result, Reference(1.5, a, x, 2., y)), 1e-10);
+
+  // Непрерывные столбцы op(A) = A^T, x — строка
+  const S21Matrix xt = Random<double>(1, 600, 13);
+  S21Matrix yt(300, 1);
+  s21::blas::Gemv(-1., a, xt, 0., yt, S21Transpose::kTranspose);
+  EXPECT_LT(MaxDiff(yt, Reference(-1., a.TransposeView(),
+                                  xt.TransposeView(), 0., yt)),
+            1e-10);
+
+  // Представление с шагами по обоим индексам
+  const auto strided = s21::MatrixView<double>(a.data(), 100, 50,
+                                               2 * a.stride(), 2);
+  S21Matrix ys(1, 100);
+  s21::blas::Gemv(1., strided, x.Submatrix(0, 0, 50, 1), 0., ys);
+  EXPECT_LT(MaxDiff(ys, Reference(1., x.Submatrix(0, 0, 50, 1).TransposeView(),
+                                  strided.TransposeView(), 0., ys)),
+            1e-12);
+
+  // x совпадает с y
+  S21Matrix square = Random<double>(4, 4, 14);
+  S21Matrix v = Random<double>(4, 1, 15);
+  const S21Matrix expected = Reference(1., square, v, 1., v);
+  s21::blas::Gemv(1., square, v, 1., v);
+  EXPECT_LT(MaxDiff(v, expected), 1e-12);
+
+  EXPECT_THROW(s21::blas::Gemv(1., a, y, 0., result), std::invalid_argument);
+  EXPECT_THROW(s21::blas::Gemv(1., a, a, 0., result), std::invalid_argument);
+}
+
+TEST(Blas, axpy_scal) {
+  S21Matrix y = Random<double>(70, 33, 16);
+  const S21Matrix y0(y);
+  const S21Matrix x = Random<double>(70, 33, 17);
+  s21::blas::Axpy(-2.5, x, y);
+  EXPECT_LT(MaxDiff(y, S21Matrix(y0 - x * 2.5)), 1e-12);
+  s21::blas::Scal(4., y);
+  EXPECT_LT(MaxDiff(y, S21Matrix((y0 - x * 2.5) * 4.)), 1e-12);
+  S21Matrix other(70, 32);
+  EXPECT_THROW(s21::blas::Axpy(1., x, other), std::invalid_argument);
+}
@@ -0,0 +1,179 @@
+#include <algorithm>
+#include <complex>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <type_traits>
+
+#include "../s21_lu.h"
+#include "../s21_matrix_io.h"
+#include "tests.h"
+
+namespace {
+
+template <class T>
+class ElementTypeTest : public ::testing::Test {
+ protected:
+  using Real = s21::RealOf<T>;
+
+  // Элемент с ненулевой мнимой частью для комплексных типов
+  static T Value(Real re, Real im) {
+    if constexpr (s21::ElementTraits<T>::kComplex) {
+      return T(re, im);
+    } else {
+      return T(re + im);
+    }
+  }
+
+  static s21::Matrix<T> Random(int rows, int cols, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dist(-1., 1.);
+    s21::Matrix<T> m(rows, cols);
+    for (int i = 0; i < rows; ++i) {
+      for (int j = 0; j < cols; ++j)
+        m(i, j) = Value(Real(dist(gen)), Real(dist(gen)));
+    }
+    return m;
+  }
+
+  // Поэлементное произведение по определению
+  static s21::Matrix<T> Naive(const s21::Matrix<T>& a,
+                              const s21::Matrix<T>& b) {
+    s21::Matrix<T> c(a.getRows(), b.getCols());
+    for (int i = 0; i < a.getRows(); ++i) {
+      for (int j = 0; j < b.getCols(); ++j) {
+        T sum = T();
+        for (int p = 0; p < a.getCols(); ++p) sum += a(i, p) * b(p, j);
+        c(i, j) = sum;
+      }
+    }
+    return c;
+  }
+
+  static Real MaxDiff(const s21::Matrix<T>& a, const s21::Matrix<T>& b) {
+    Real diff = 0;
+    for (int i = 0; i < a.getRows(); ++i) {
+      for (int j = 0; j < a.getCols(); ++j)
+        diff = std::max(diff, Real(std::abs(a(i, j) - b(i, j))));
+    }
+    return diff;
+  }
+};
+
+using ElementTypes =
+    ::testing::Types<float, double, long double, std::complex<float>,
+                     std::complex<double>>;
+TYPED_TEST_SUITE(ElementTypeTest, ElementTypes);
+
+TYPED_TEST(ElementTypeTest, Arithmetic) {
+  using T = TypeParam;
+  const auto a = TestFixture::Random(5, 7, 1);
+  const auto b = TestFixture::Random(5, 7, 2);
+
+  s21::Matrix<T> sum = a + b * T(2) - a;
+  s21::Matrix<T> expected(5, 7);
+  for (int i = 0; i < 5; ++i) {
+    for (int j = 0; j < 7; ++j) expected(i, j) = b(i, j) * T(2);
+  }
+  EXPECT_TRUE(sum.EqMatrix(expected));
+
+  auto scaled = a;
+  scaled.MulNumber(T(3));
+  scaled.SubMatrix(a);
+  scaled.SubMatrix(a);
+  scaled.SubMatrix(a);
+  EXPECT_TRUE(scaled.EqMatrix(s21::Matrix<T>(5, 7)));
+}
+
+TYPED_TEST(ElementTypeTest, Multiplication) {
+  using Real = typename TestFixture::Real;
+  const auto a = TestFixture::Random(37, 45, 3);
+  const auto b = TestFixture::Random(45, 29, 4);
+  const auto expected = TestFixture::Naive(a, b);
+
+  const Real tolerance = 45 * 8 * std::numeric_limits<Real>::epsilon();
+  EXPECT_LE(TestFixture::MaxDiff(a * b, expected), tolerance);
+  EXPECT_LE(TestFixture::MaxDiff(a.Submatrix(0, 0, 37, 45) * b, expected),
+            tolerance);
+
+  auto c = a;
+  c.MulMatrix(b, S21MulAlgorithm::kStrassen);
+  EXPECT_LE(TestFixture::MaxDiff(c, expected), tolerance);
+
+  // Транспонирование с векторной плиткой и без неё
+  auto t = a;
+  t = t.Transpose().Transpose();
+  EXPECT_EQ(TestFixture::MaxDiff(t, a), Real(0));
+  auto square = TestFixture::Random(19, 19, 5);
+  auto copy = square;
+  square.TransposeInPlace();
+  EXPECT_EQ(TestFixture::MaxDiff(square, copy.TransposeView()), Real(0));
+}
+
+TYPED_TEST(ElementTypeTest, DeterminantAndInverse) {
+  using T = TypeParam;
+  using Real = typename TestFixture::Real;
+  s21::Matrix<T> m(3, 3);
+  const T values[] = {T(2), T(-1), T(0), T(-1), T(2), T(-1), T(0), T(-1), T(2)};
+  m.fillMatrixArr(values);
+  EXPECT_LE(std::abs(m.Determinant() - T(4)), 100 * m.kEpsilon);
+
+  const auto a = TestFixture::Random(70, 70, 6);
+  auto inverse = s21::Matrix<T>(a).InverseMatrix();
+  s21::Matrix<T> identity(70, 70);
+  for (int i = 0; i < 70; ++i) identity(i, i) = T(1);
+  EXPECT_LE(TestFixture::MaxDiff(a * inverse, identity),
+            Real(1e5) * std::numeric_limits<Real>::epsilon());
+
+  s21::Matrix<T> singular(3, 3);
+  singular.fillMatrix(T(1));
+  EXPECT_EQ(singular.Determinant(), T(0));
+  EXPECT_THROW(singular.InverseMatrix(), std::invalid_argument);
+}
+
+TYPED_TEST(ElementTypeTest, Tolerance) {
+  using T = TypeParam;
+  using Real = typename TestFixture::Real;
+  const Real eps = s21::ElementTraits<T>::kEpsilon;
+  s21::Matrix<T> a(2, 2);
+  a.fillMatrix(TestFixture::Value(Real(1), Real(-1)));
+  s21::Matrix<T> b = a;
+  b(1, 1) += TestFixture::Value(eps / 2, 0);
+  EXPECT_TRUE(a == b);
+  b(1, 1) += TestFixture::Value(eps, 0);
+  EXPECT_FALSE(a == b);
+}
+
+TYPED_TEST(ElementTypeTest, TextAndBinaryFiles) {
+  using T = TypeParam;
+  const auto a = TestFixture::Random(4, 9, 7);
+
+  std::stringstream text;
+  a.writeText(text);
+  EXPECT_EQ(TestFixture::MaxDiff(s21::Matrix<T>::readText(text), a), 0);
+
+  const std::string path = ::testing::TempDir() + "element_type.s21m";
+  a.saveBinary(path);
+  EXPECT_EQ(TestFixture::MaxDiff(s21::Matrix<T>::loadBinary(path), a), 0);
+  const s21::MappedMatrix<T> mapped(path);
+  EXPECT_TRUE(a == mapped.view());
+  // Файл с другим типом элементов не читается
+  if constexpr (!std::is_same_v<T, double>) {
+    EXPECT_THROW(S21Matrix::loadBinary(path), std::invalid_argument);
+  }
+  std::remove(path.c_str());
+}
+
+TEST(ElementTypeTest, DefaultAlias) {
+  static_assert(std::is_same_v<S21Matrix, s21::Matrix<double>>);
+  static_assert(std::is_same_v<S21MatrixView, s21::MatrixView<double>>);
+  EXPECT_EQ(S21Matrix::kEpsilon, EPS);
+
+  // Нечётное количество чисел не образует комплексную строку
+  std::istringstream text("1 2 3\n");
+  EXPECT_THROW(s21::Matrix<std::complex<double>>::readText(text),
+               std::invalid_argument);
+}
+
+}  // namespace
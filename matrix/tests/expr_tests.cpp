@@ -0,0 +1,50 @@
+#include <type_traits>
+#include <vector>
+
+#include "tests.h"
+
+namespace {
+
+S21Matrix Make(int rows, int cols, std::vector<double> values) {
+  S21Matrix m(rows, cols);
+  m.fillMatrixArr(values.data());
+  return m;
+}
+
+}  // namespace
+
+TEST(Expr, eval) {
+  const S21Matrix a = Make(2, 2, {1, 2, 3, 4});
+  const S21Matrix b = Make(2, 2, {4, 3, 2, 1});
+
+  // auto хранит выражение; eval() даёт матрицу с полным интерфейсом
+  auto expr = a + b;
+  static_assert(!std::is_same_v<decltype(expr), S21Matrix>);
+  auto r = expr.eval();
+  static_assert(std::is_same_v<decltype(r), S21Matrix>);
+  r.MulNumber(2.);
+  EXPECT_TRUE(r == Make(2, 2, {10, 10, 10, 10}));
+
+  S21Matrix m = a - b * 2.;
+  m.MulNumber(-1.);
+  EXPECT_TRUE(m == Make(2, 2, {7, 4, 1, -2}));
+}
+
+TEST(Expr, matrix_operations) {
+  const S21Matrix a = Make(2, 2, {1, 2, 3, 4});
+  const S21Matrix b = Make(2, 2, {0, 1, 1, 0});
+
+  // Неизменяющие операции вычисляют выражение перед вызовом
+  S21Matrix c = (a + b).Transpose();
+  EXPECT_TRUE(c == Make(2, 2, {1, 4, 3, 4}));
+  EXPECT_DOUBLE_EQ((a + b).Determinant(), -8.);
+  EXPECT_TRUE((a - b * 2.).EqMatrix(Make(2, 2, {1, 0, 1, 4})));
+  EXPECT_TRUE((a * 2.).InverseMatrix() ==
+              Make(2, 2, {-1, 0.5, 0.75, -0.25}));
+  EXPECT_TRUE((a + b).CalcComplements() == Make(2, 2, {4, -4, -3, 1}));
+
+  // Выражение с перемещённой временной матрицей
+  S21Matrix t = (S21Matrix(a) + b).Transpose();
+  EXPECT_TRUE(t == c);
+  EXPECT_EQ((a + b)(1, 0), 4.);
+}
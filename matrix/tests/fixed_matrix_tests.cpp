@@ -0,0 +1,69 @@
+#include "../s21_fixed_matrix.h"
+#include "tests.h"
+
+namespace {
+constexpr S21FixedMatrix<3, 3> kMatrix{2, 5, 7, 6, 3, 4, 5, -2, -3};
+}  // namespace
+
+static_assert(kMatrix.Determinant() == -1., "constexpr determinant");
+static_assert((kMatrix * kMatrix.InverseMatrix())(2, 2) == 1.,
+              "constexpr inverse");
+static_assert(kMatrix.CalcComplements()(0, 0) == -1. &&
+                  kMatrix.CalcComplements()(2, 1) == 34.,
+              "constexpr complements");
+static_assert(sizeof(S21FixedMatrix<4, 4>) == 16 * sizeof(double),
+              "inline storage");
+
+TEST(Fixed, determinant_small) {
+  EXPECT_DOUBLE_EQ((S21FixedMatrix<1, 1>{4}.Determinant()), 4.);
+  EXPECT_DOUBLE_EQ((S21FixedMatrix<2, 2>{1, 2, 3, 4}.Determinant()), -2.);
+  S21FixedMatrix<4, 4> m{1, 0, 2, -1, 3, 0, 0, 5, 2, 1, 4, -3, 1, 0, 5, 0};
+  EXPECT_DOUBLE_EQ(m.Determinant(), 30.);
+}
+
+TEST(Fixed, inverse_matches_dynamic) {
+  S21FixedMatrix<4, 4> m{4, 7, 2, 3, 0, 5, 1, 8, 3, 2, 9, 1, 6, 1, 2, 7};
+  S21Matrix dynamic = m;
+  using Fixed = S21FixedMatrix<4, 4>;
+  EXPECT_TRUE(Fixed(dynamic.InverseMatrix()) == m.InverseMatrix());
+  EXPECT_TRUE(Fixed(dynamic.CalcComplements()) == m.CalcComplements());
+
+  using Fixed2 = S21FixedMatrix<2, 2>;
+  const Fixed2 m2{1, 2, 3, 4};
+  S21Matrix dynamic2 = m2;
+  EXPECT_TRUE(Fixed2(dynamic2.CalcComplements()) == m2.CalcComplements());
+  using Fixed3 = S21FixedMatrix<3, 3>;
+  S21Matrix dynamic3 = kMatrix;
+  EXPECT_TRUE(Fixed3(dynamic3.CalcComplements()) ==
+              kMatrix.CalcComplements());
+}
+
+TEST(Fixed, large_fallback) {
+  S21FixedMatrix<5, 5> m{2, 1, 0, 0, 3, 1, 3, 1, 0, 0, 0, 1, 4, 1, 0,
+                         0, 0, 1, 5, 1, 1, 0, 0, 1, 6};
+  S21Matrix dynamic = m;
+  EXPECT_NEAR(m.Determinant(), dynamic.Determinant(), 1e-9);
+  using Fixed = S21FixedMatrix<5, 5>;
+  EXPECT_TRUE(Fixed(dynamic.InverseMatrix()) == m.InverseMatrix());
+}
+
+TEST(Fixed, arithmetic) {
+  S21FixedMatrix<2, 3> a{1, 2, 3, 4, 5, 6};
+  S21FixedMatrix<3, 2> b = a.Transpose();
+  S21FixedMatrix<2, 2> c = a * b;
+  EXPECT_EQ(c(0, 0), 14.);
+  EXPECT_EQ(c(1, 1), 77.);
+  a += a * 2.;
+  EXPECT_EQ(a(1, 2), 18.);
+  a -= S21FixedMatrix<2, 3>{1, 1, 1, 1, 1, 1};
+  EXPECT_EQ(a(0, 0), 2.);
+  c *= S21FixedMatrix<2, 2>{1, 0, 0, 1};
+  EXPECT_EQ(c(0, 1), 32.);
+}
+
+TEST(Fixed, errors) {
+  S21FixedMatrix<2, 2> singular{1, 2, 2, 4};
+  EXPECT_THROW(singular.InverseMatrix(), std::invalid_argument);
+  EXPECT_THROW(singular(2, 0), std::out_of_range);
+  EXPECT_THROW((S21FixedMatrix<2, 2>(S21Matrix(3, 3))), std::invalid_argument);
+}
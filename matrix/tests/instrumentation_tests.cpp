@@ -0,0 +1,59 @@
+#include <sstream>
+
+#include "../s21_instrumentation.h"
+#include "tests.h"
+
+namespace instrumentation = s21::instrumentation;
+using instrumentation::Counter;
+using instrumentation::Operation;
+
+TEST(Instrumentation, memory_counters) {
+  if (!instrumentation::Enabled()) GTEST_SKIP();
+  S21Matrix a(4, 4);
+  instrumentation::Reset();
+
+  S21Matrix b(a);
+  S21Matrix c(std::move(b));
+  b = c;  // Новый буфер через копию
+  c = a;  // Копирование в существующий буфер
+  const auto snapshot = instrumentation::TakeSnapshot();
+  EXPECT_EQ(snapshot[Counter::kAllocations], 2u);
+  EXPECT_EQ(snapshot[Counter::kAllocatedBytes], 2 * 4 * 8 * sizeof(double));
+  EXPECT_EQ(snapshot[Counter::kDeepCopies], 3u);
+  EXPECT_EQ(snapshot[Counter::kBytesCopied], 3 * 4 * 8 * sizeof(double));
+  EXPECT_EQ(snapshot[Counter::kMoves], 1u);
+
+  instrumentation::Reset();
+  EXPECT_EQ(instrumentation::TakeSnapshot()[Counter::kAllocations], 0u);
+}
+
+TEST(Instrumentation, operations) {
+  if (!instrumentation::Enabled()) GTEST_SKIP();
+  S21Matrix a(3, 4);
+  S21Matrix b(4, 5);
+  S21Matrix square(5, 5);
+  for (int i = 0; i < 5; ++i) square(i, i) = 2;
+  instrumentation::Reset();
+
+  a.MulMatrix(b);
+  S21Matrix product = square * square;
+  square.InverseMatrix();
+  EXPECT_THROW(S21Matrix(2, 3).SumMatrix(S21Matrix(3, 2)),
+               std::invalid_argument);
+
+  const auto snapshot = instrumentation::TakeSnapshot();
+  // Вложенный MulAddMatrix не учитывается отдельно
+  EXPECT_EQ(snapshot[Operation::kMulMatrix].calls, 2u);
+  EXPECT_EQ(snapshot[Operation::kMulMatrix].flops, 2u * 3 * 4 * 5 + 2 * 125);
+  EXPECT_EQ(snapshot[Operation::kMulAddMatrix].calls, 0u);
+  EXPECT_EQ(snapshot[Operation::kInverseMatrix].calls, 1u);
+  EXPECT_EQ(snapshot[Operation::kInverseMatrix].flops, 250u);
+  EXPECT_EQ(snapshot[Operation::kSumMatrix].calls, 0u);
+  EXPECT_EQ(snapshot.flops(), 620u);
+
+  std::ostringstream json;
+  instrumentation::WriteJson(json, snapshot);
+  EXPECT_NE(json.str().find("\"enabled\": true"), std::string::npos);
+  EXPECT_NE(json.str().find("\"MulMatrix\": {\"calls\": 2, \"flops\": 370"),
+            std::string::npos);
+}
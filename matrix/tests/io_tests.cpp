@@ -0,0 +1,112 @@
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "../s21_matrix_io.h"
+#include "tests.h"
+
+namespace {
+
+S21Matrix Sample(int rows, int cols) {
+  S21Matrix m(rows, cols);
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) m(i, j) = (i - 2.5 * j) / 3.;
+  }
+  return m;
+}
+
+bool SameBits(const S21Matrix& a, const S21Matrix& b) {
+  if (a.getRows() != b.getRows() || a.getCols() != b.getCols()) return false;
+  for (int i = 0; i < a.getRows(); ++i) {
+    for (int j = 0; j < a.getCols(); ++j) {
+      if (a(i, j) != b(i, j)) return false;
+    }
+  }
+  return true;
+}
+
+std::string TempPath(const char* name) { return testing::TempDir() + name; }
+
+}  // namespace
+
+TEST(Io, text_round_trip) {
+  S21Matrix m = Sample(7, 5);
+  m(0, 0) = 5e-324;
+  m(1, 1) = -1.7976931348623157e308;
+  for (char separator : {' ', ','}) {
+    std::stringstream stream;
+    m.writeText(stream, separator);
+    EXPECT_TRUE(SameBits(S21Matrix::readText(stream), m));
+  }
+}
+
+TEST(Io, text_separators) {
+  std::istringstream in("1, 2;3\r\n\n  +4\t-5e1 .5\n");
+  S21Matrix m = S21Matrix::readText(in);
+  ASSERT_EQ(m.getRows(), 2);
+  ASSERT_EQ(m.getCols(), 3);
+  EXPECT_EQ(m(0, 2), 3.);
+  EXPECT_EQ(m(1, 0), 4.);
+  EXPECT_EQ(m(1, 1), -50.);
+  EXPECT_EQ(m(1, 2), .5);
+
+  std::istringstream ragged("1 2\n3\n");
+  EXPECT_THROW(S21Matrix::readText(ragged), std::invalid_argument);
+  std::istringstream garbage("1 2x\n");
+  EXPECT_THROW(S21Matrix::readText(garbage), std::invalid_argument);
+  std::istringstream empty("\n\n");
+  EXPECT_THROW(S21Matrix::readText(empty), std::invalid_argument);
+}
+
+TEST(Io, text_longer_than_chunk) {
+  S21Matrix m = Sample(300, 200);
+  std::stringstream stream;
+  m.writeText(stream);
+  EXPECT_TRUE(SameBits(S21Matrix::readText(stream), m));
+}
+
+TEST(Io, binary_round_trip) {
+  const std::string path = TempPath("s21_matrix_io.bin");
+  S21Matrix m = Sample(13, 11);
+  m.saveBinary(path);
+  EXPECT_TRUE(SameBits(S21Matrix::loadBinary(path), m));
+
+  S21MappedMatrix mapped(path);
+  EXPECT_EQ(mapped.getRows(), 13);
+  EXPECT_EQ(mapped.getCols(), 11);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(mapped.data()) %
+                S21Matrix::kAlignment,
+            0u);
+  EXPECT_TRUE(m == mapped.view());
+  S21Matrix product = mapped.view().TransposeView() * mapped.view();
+  EXPECT_TRUE(product == m.TransposeView() * m);
+
+  S21MappedMatrix moved(std::move(mapped));
+  EXPECT_EQ(mapped.data(), nullptr);
+  EXPECT_TRUE(m == moved.view());
+  std::remove(path.c_str());
+}
+
+TEST(Io, binary_errors) {
+  EXPECT_THROW(S21Matrix::loadBinary(TempPath("missing.bin")),
+               std::runtime_error);
+
+  const std::string path = TempPath("s21_matrix_bad.bin");
+  std::ofstream(path) << "not a matrix file, but long enough for a header "
+                         "to be read from it completely";
+  EXPECT_THROW(S21Matrix::loadBinary(path), std::invalid_argument);
+  EXPECT_THROW(S21MappedMatrix{path}, std::invalid_argument);
+
+  // Файл без последних байтов payload
+  Sample(4, 4).saveBinary(path);
+  std::string bytes;
+  {
+    std::ifstream in(path, std::ios::binary);
+    bytes.assign(std::istreambuf_iterator<char>(in), {});
+  }
+  std::ofstream(path, std::ios::binary | std::ios::trunc)
+      .write(bytes.data(), static_cast<std::streamsize>(bytes.size() - 8));
+  EXPECT_THROW(S21Matrix::loadBinary(path), std::invalid_argument);
+  EXPECT_THROW(S21MappedMatrix{path}, std::invalid_argument);
+  std::remove(path.c_str());
+}
@@ -0,0 +1,141 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "tests.h"
+
+// Подсчёт выделений памяти под буферы матриц: S21Matrix выделяет память
+// через выровненный operator new, который здесь заменён счётчиком
+namespace {
+std::atomic<long> allocations{0};
+
+long Allocations() { return allocations.load(); }
+
+S21Matrix Filled(int rows, int cols, double val) {
+  S21Matrix m(rows, cols);
+  m.fillMatrix(val);
+  return m;
+}
+}  // namespace
+
+void* operator new(std::size_t size, std::align_val_t align) {
+  ++allocations;
+  const auto alignment = static_cast<std::size_t>(align);
+  void* ptr = std::aligned_alloc(
+      alignment, (size + alignment - 1) / alignment * alignment);
+  if (!ptr) throw std::bad_alloc();
+  return ptr;
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {
+  std::free(ptr);
+}
+
+TEST(Move, move_constructor) {
+  S21Matrix a = Filled(3, 3, 1.5);
+  const double* buffer = a.data();
+  const long before = Allocations();
+  S21Matrix b(std::move(a));
+  EXPECT_EQ(Allocations(), before);
+  EXPECT_EQ(b.data(), buffer);
+  EXPECT_EQ(a.getRows(), 0);
+  EXPECT_EQ(b(2, 2), 1.5);
+}
+
+TEST(Move, move_assignment) {
+  S21Matrix a = Filled(3, 4, 2.);
+  S21Matrix b(5, 5);
+  const double* buffer = a.data();
+  const long before = Allocations();
+  b = std::move(a);
+  EXPECT_EQ(Allocations(), before);
+  EXPECT_EQ(b.data(), buffer);
+  EXPECT_EQ(b.getRows(), 3);
+  EXPECT_EQ(b.getCols(), 4);
+  EXPECT_EQ(a.data(), nullptr);
+  EXPECT_TRUE(std::is_nothrow_move_assignable_v<S21Matrix>);
+  EXPECT_TRUE(std::is_nothrow_move_constructible_v<S21Matrix>);
+}
+
+TEST(Move, copy_assignment_same_size) {
+  S21Matrix a = Filled(4, 4, 3.);
+  S21Matrix b(4, 4);
+  const long before = Allocations();
+  b = a;
+  EXPECT_EQ(Allocations(), before);
+  EXPECT_TRUE(a == b);
+}
+
+TEST(Move, rvalue_sum_reuses_left) {
+  S21Matrix a = Filled(8, 8, 1.);
+  S21Matrix b = Filled(8, 8, 2.);
+  const double* buffer = a.data();
+  const long before = Allocations();
+  S21Matrix c = std::move(a) + b;
+  EXPECT_EQ(Allocations(), before);
+  EXPECT_EQ(c.data(), buffer);
+  EXPECT_EQ(c(7, 7), 3.);
+}
+
+TEST(Move, rvalue_chain_reuses_temporary) {
+  S21Matrix a = Filled(8, 8, 1.);
+  S21Matrix b = Filled(8, 8, 2.);
+  const long before = Allocations();
+  S21Matrix c = Filled(8, 8, 4.) - a * 2. + b;
+  EXPECT_EQ(Allocations(), before + 1);  // Только сама временная матрица
+  EXPECT_EQ(c(0, 0), 4.);
+}
+
+TEST(Move, rvalue_scale_reuses_operand) {
+  S21Matrix a = Filled(5, 6, 1.5);
+  const long before = Allocations();
+  S21Matrix c = std::move(a) * 2.;
+  EXPECT_EQ(Allocations(), before);
+  EXPECT_EQ(c(4, 5), 3.);
+}
+
+TEST(Move, lvalue_chain_single_allocation) {
+  S21Matrix a = Filled(6, 6, 1.);
+  S21Matrix b = Filled(6, 6, 2.);
+  S21Matrix c = Filled(6, 6, 3.);
+  const long before = Allocations();
+  S21Matrix d = a + b - c * 2.;
+  EXPECT_EQ(Allocations(), before + 1);
+  d = a - b + c;
+  EXPECT_EQ(Allocations(), before + 1);
+  EXPECT_EQ(d(5, 5), 2.);
+}
+
+TEST(Move, assignment_of_other_size_reuses_temporary) {
+  S21Matrix a = Filled(3, 3, 1.);
+  S21Matrix d(2, 2);
+  const long before = Allocations();
+  d = std::move(a) * 3.;
+  EXPECT_EQ(Allocations(), before);
+  EXPECT_EQ(d.getRows(), 3);
+  EXPECT_EQ(d(1, 1), 3.);
+}
+
+TEST(Move, mul_matrix_single_allocation) {
+  S21Matrix a = Filled(10, 20, 1.);
+  S21Matrix b = Filled(20, 30, 2.);
+  a.MulMatrix(b);  // Прогрев буферов упаковки GEMM
+  a = Filled(10, 20, 1.);
+  const long before = Allocations();
+  a.MulMatrix(b);
+  EXPECT_EQ(Allocations(), before + 1);
+  EXPECT_EQ(a.getCols(), 30);
+  EXPECT_EQ(a(9, 29), 40.);
+}
+
+TEST(Move, set_rows_single_allocation) {
+  S21Matrix a = Filled(3, 3, 1.);
+  const long before = Allocations();
+  a.setRows(5);
+  a.setCols(2);
+  EXPECT_EQ(Allocations(), before + 2);
+  EXPECT_EQ(a(2, 1), 1.);
+  EXPECT_EQ(a(4, 1), 0.);
+}
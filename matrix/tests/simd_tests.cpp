@@ -0,0 +1,98 @@
+#include <complex>
+#include <random>
+#include <vector>
+
+#include "../s21_simd.h"
+#include "tests.h"
+
+namespace {
+
+// Длины 0..67 покрывают все хвосты векторных циклов (до 8 элементов за
+// итерацию) и маски AVX-512; сдвиг на один элемент даёт невыровненные
+// адреса
+constexpr std::size_t kMaxLength = 67;
+
+template <class T>
+std::vector<T> Random(std::size_t n, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> value(-1., 1.);
+  std::vector<T> v(n);
+  for (T& x : v) x = T(value(gen));
+  return v;
+}
+
+template <class T>
+void ExpectNear(const T* a, const T* b, std::size_t n, double tolerance,
+                const char* kernels, std::size_t length) {
+  for (std::size_t i = 0; i < n; ++i) {
+    EXPECT_LE(std::abs(a[i] - b[i]), tolerance)
+        << kernels << ", n = " << length << ", i = " << i;
+  }
+}
+
+// Каждый доступный набор сравнивается со скалярной реализацией
+template <class T>
+void CheckAvailable() {
+  using namespace s21::simd;
+  const BasicKernels<T>& scalar = Scalar<T>();
+  const auto sets = Available<T>();
+  ASSERT_FALSE(sets.empty());
+  EXPECT_EQ(sets.front(), &scalar);
+  EXPECT_EQ(sets.back(), &Active<T>());
+
+  const T alpha = T(0.75);
+  const s21::RealOf<T> eps = s21::RealOf<T>(1e-3);
+  for (const BasicKernels<T>* set : sets) {
+    for (std::size_t n = 0; n <= kMaxLength; ++n) {
+      for (std::size_t offset = 0; offset < 2; ++offset) {
+        const std::vector<T> src = Random<T>(n + offset, 1);
+        const std::vector<T> dst = Random<T>(n + offset, 2);
+        const T* s = src.data() + offset;
+
+        std::vector<T> expected = dst, actual = dst;
+        T* e = expected.data() + offset;
+        T* a = actual.data() + offset;
+        scalar.add(e, s, n);
+        set->add(a, s, n);
+        ExpectNear(a, e, n, 0., set->name, n);
+
+        expected = actual = dst;
+        scalar.sub(e, s, n);
+        set->sub(a, s, n);
+        ExpectNear(a, e, n, 0., set->name, n);
+
+        expected = actual = dst;
+        scalar.scale(e, alpha, n);
+        set->scale(a, alpha, n);
+        ExpectNear(a, e, n, 0., set->name, n);
+
+        // FMA округляет один раз, поэтому допускается погрешность
+        expected = actual = dst;
+        scalar.axpy(e, alpha, s, n);
+        set->axpy(a, alpha, s, n);
+        ExpectNear(a, e, n, 1e-6, set->name, n);
+
+        // Отличие в любой позиции, включая хвост
+        actual = src;
+        EXPECT_TRUE(set->equal(s, a, n, eps)) << set->name << ", n = " << n;
+        for (std::size_t i = 0; i < n; ++i) {
+          a[i] += T(eps / 2);
+          EXPECT_TRUE(set->equal(s, a, n, eps))
+              << set->name << ", n = " << n << ", i = " << i;
+          a[i] += T(eps);
+          EXPECT_FALSE(set->equal(s, a, n, eps))
+              << set->name << ", n = " << n << ", i = " << i;
+          a[i] = s[i];
+        }
+      }
+    }
+  }
+}
+
+}  // namespace
+
+TEST(Simd, available_double) { CheckAvailable<double>(); }
+
+TEST(Simd, available_float) { CheckAvailable<float>(); }
+
+TEST(Simd, available_complex) { CheckAvailable<std::complex<double>>(); }
@@ -0,0 +1,210 @@
+#include <complex>
+#include <random>
+#include <vector>
+
+#include "../s21_solve.h"
+#include "tests.h"
+
+namespace {
+
+template <class T>
+s21::Matrix<T> Random(int rows, int cols, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> value(-1., 1.);
+  s21::Matrix<T> m(rows, cols);
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      if constexpr (s21::ElementTraits<T>::kComplex) {
+        m(i, j) = T(value(gen), value(gen));
+      } else {
+        m(i, j) = T(value(gen));
+      }
+    }
+  }
+  return m;
+}
+
+// A^H * A + n * E — эрмитова положительно определённая матрица
+template <class T>
+s21::Matrix<T> RandomSpd(int n, unsigned seed) {
+  const s21::Matrix<T> a = Random<T>(n, n, seed);
+  s21::Matrix<T> spd(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      T sum = i == j ? T(n) : T();
+      for (int p = 0; p < n; ++p) sum += s21::Conjugate(a(p, i)) * a(p, j);
+      spd(i, j) = sum;
+    }
+  }
+  return spd;
+}
+
+template <class T>
+double MaxDiff(const s21::Matrix<T>& a, const s21::Matrix<T>& b) {
+  double diff = 0;
+  for (int i = 0; i < a.getRows(); ++i) {
+    for (int j = 0; j < a.getCols(); ++j)
+      diff = std::max(diff, double(std::abs(a(i, j) - b(i, j))));
+  }
+  return diff;
+}
+
+}  // namespace
+
+TEST(Solve, lu_many_right_hand_sides) {
+  // Размер больше блока, чтобы работали блочные подстановки и GEMM
+  const S21Matrix a = Random<double>(150, 150, 1);
+  const S21Matrix b = Random<double>(150, 70, 2);
+  const S21LU lu(a);
+  const S21Matrix x = lu.solve(b);
+  EXPECT_LT(MaxDiff(a * x, b), 1e-10);
+  EXPECT_TRUE(s21::Solve(a, b) == x);
+  EXPECT_TRUE(lu.solve(b.ColSlice(3)) == x.ColSlice(3));
+}
+
+TEST(Solve, lu_badly_scaled) {
+  // Вырожденность определяется точным нулём ведущего элемента, а не
+  // порогом относительно наибольшего элемента матрицы
+  S21Matrix diag(3, 3);
+  diag(0, 0) = 1e12;
+  diag(1, 1) = diag(2, 2) = 1.;
+  EXPECT_FALSE(S21LU(diag).isSingular());
+  EXPECT_EQ(diag.Determinant(), 1e12);
+  const S21Matrix inverse = diag.InverseMatrix();
+  EXPECT_EQ(inverse(0, 0), 1e-12);
+  EXPECT_EQ(inverse(2, 2), 1.);
+
+  S21Matrix small(2, 2);
+  small(0, 0) = 1e10;
+  small(1, 1) = 1.;
+  S21Matrix b(2, 1);
+  b(0, 0) = 1e10;
+  b(1, 0) = 2.;
+  const S21Matrix x = s21::Solve(small, b);
+  EXPECT_DOUBLE_EQ(x(0, 0), 1.);
+  EXPECT_DOUBLE_EQ(x(1, 0), 2.);
+
+  // Треугольные матрицы с диагональю от 1e-8 до 1 и элементами до 1e20
+  S21Matrix upper(3, 3);
+  upper.fillMatrixArr(
+      std::vector<double>{1, 1e20, 0, 0, 1, 1e15, 0, 0, 1e-8}.data());
+  EXPECT_DOUBLE_EQ(upper.Determinant(), 1e-8);
+  S21Matrix lower(2, 2);
+  lower.fillMatrixArr(std::vector<double>{1e-12, 0, 1, 1}.data());
+  EXPECT_DOUBLE_EQ(lower.Determinant(), 1e-12);
+  S21Matrix identity(2, 2);
+  identity(0, 0) = identity(1, 1) = 1.;
+  EXPECT_LT(MaxDiff(lower * S21Matrix(lower).InverseMatrix(), identity),
+            1e-12);
+
+  // Точно вырожденная матрица
+  S21Matrix singular(2, 2);
+  singular.fillMatrixArr(std::vector<double>{1, 2, 2, 4}.data());
+  EXPECT_TRUE(S21LU(singular).isSingular());
+  EXPECT_EQ(singular.Determinant(), 0.);
+  EXPECT_THROW(singular.InverseMatrix(), std::invalid_argument);
+}
+
+TEST(Solve, cholesky) {
+  const S21Matrix a = RandomSpd<double>(170, 3);
+  const S21Matrix b = Random<double>(170, 5, 4);
+  const S21Cholesky cholesky(a);
+  ASSERT_TRUE(cholesky.isPositiveDefinite());
+  const S21Matrix x = cholesky.solve(b);
+  EXPECT_LT(MaxDiff(a * x, b), 1e-10);
+  EXPECT_TRUE(s21::Solve(a, b, S21SolveMethod::kCholesky) == x);
+
+  const S21Matrix l = cholesky.lower();
+  EXPECT_LT(MaxDiff(l * S21Matrix(l).Transpose(), a), 1e-9);
+  EXPECT_LT(MaxDiff(cholesky.inverse(), S21Matrix(a).InverseMatrix()), 1e-12);
+  const S21Matrix small = RandomSpd<double>(6, 5);
+  EXPECT_NEAR(S21Cholesky(small).determinant(),
+              S21Matrix(small).Determinant(), 1e-8);
+}
+
+TEST(Solve, cholesky_not_positive_definite) {
+  S21Matrix a(2, 2);
+  a.fillMatrixArr(std::vector<double>{1, 2, 2, 1}.data());
+  const S21Cholesky cholesky(a);
+  EXPECT_FALSE(cholesky.isPositiveDefinite());
+  EXPECT_THROW(cholesky.solve(S21Matrix(2, 1)), std::invalid_argument);
+  EXPECT_THROW(cholesky.determinant(), std::invalid_argument);
+  EXPECT_THROW(S21Cholesky(S21Matrix(2, 3)), std::invalid_argument);
+}
+
+TEST(Solve, qr_least_squares) {
+  const S21Matrix a = Random<double>(230, 140, 6);
+  const S21Matrix b = Random<double>(230, 3, 7);
+  const S21QR qr(a);
+  ASSERT_TRUE(qr.isFullRank());
+  const S21Matrix x = qr.solve(b);
+
+  // Невязка ортогональна столбцам A: A^T * (A * X - B) = 0
+  S21Matrix at = S21Matrix(a).Transpose();
+  EXPECT_LT(MaxDiff(at * (a * x - b), S21Matrix(140, 3)), 1e-10);
+  EXPECT_TRUE(s21::Solve(a, b, S21SolveMethod::kQR) == x);
+
+  // R^T * R = A^T * A
+  S21Matrix r = qr.r();
+  EXPECT_LT(MaxDiff(S21Matrix(r).Transpose() * r, at * a), 1e-9);
+
+  // Для квадратной системы совпадает с LU
+  const S21Matrix square = Random<double>(90, 90, 8);
+  const S21Matrix rhs = Random<double>(90, 2, 9);
+  EXPECT_LT(MaxDiff(S21QR(square).solve(rhs), S21LU(square).solve(rhs)),
+            1e-9);
+}
+
+TEST(Solve, qr_rank_deficient) {
+  S21Matrix a = Random<double>(10, 4, 10);
+  for (int i = 0; i < 10; ++i) a(i, 3) = a(i, 0) - a(i, 1);
+  const S21QR qr(a);
+  EXPECT_FALSE(qr.isFullRank());
+  EXPECT_THROW(qr.solve(S21Matrix(10, 1)), std::invalid_argument);
+  EXPECT_THROW(S21QR(S21Matrix(3, 4)), std::invalid_argument);
+  EXPECT_THROW(S21QR(a).solve(S21Matrix(9, 1)), std::invalid_argument);
+}
+
+TEST(Solve, cholesky_qr_badly_scaled) {
+  // Масштаб одного столбца не делает остальные нулевыми
+  S21Matrix diag(2, 2);
+  diag(0, 0) = 1e10;
+  diag(1, 1) = 1.;
+  S21Matrix b(2, 1);
+  b(0, 0) = 1e10;
+  b(1, 0) = 2.;
+  EXPECT_TRUE(S21Cholesky(diag).isPositiveDefinite());
+  EXPECT_TRUE(S21QR(diag).isFullRank());
+  for (auto method : {S21SolveMethod::kCholesky, S21SolveMethod::kQR}) {
+    const S21Matrix x = s21::Solve(diag, b, method);
+    EXPECT_DOUBLE_EQ(x(0, 0), 1.);
+    EXPECT_DOUBLE_EQ(x(1, 0), 2.);
+  }
+
+  // Столбцы разного масштаба, один из них — нулевой
+  S21Matrix tall(3, 2);
+  tall.fillMatrixArr(std::vector<double>{1e12, 0, 0, 0, 1, 0}.data());
+  EXPECT_FALSE(S21QR(tall).isFullRank());
+  tall(1, 1) = 1e-6;
+  EXPECT_TRUE(S21QR(tall).isFullRank());
+}
+
+TEST(Solve, complex) {
+  using C = std::complex<double>;
+  const s21::Matrix<C> spd = RandomSpd<C>(80, 11);
+  const s21::Matrix<C> b = Random<C>(80, 4, 12);
+  const s21::Matrix<C> x = s21::Solve(spd, b, S21SolveMethod::kCholesky);
+  EXPECT_LT(MaxDiff(spd * x, b), 1e-10);
+  EXPECT_LT(MaxDiff(s21::Solve(spd, b), x), 1e-10);
+
+  const s21::Matrix<C> a = Random<C>(100, 70, 13);
+  const s21::Matrix<C> y = s21::Solve(a, Random<C>(100, 2, 14),
+                                      S21SolveMethod::kQR);
+  s21::Matrix<C> ah(70, 100);
+  for (int i = 0; i < 100; ++i) {
+    for (int j = 0; j < 70; ++j) ah(j, i) = std::conj(a(i, j));
+  }
+  EXPECT_LT(MaxDiff(ah * (a * y - Random<C>(100, 2, 14)),
+                    s21::Matrix<C>(70, 2)),
+            1e-10);
+}
@@ -0,0 +1,98 @@
+#include <random>
+
+#include "../s21_sparse_matrix.h"
+#include "tests.h"
+
+namespace {
+
+// Случайная плотная матрица, в которой ненулевой примерно каждый density
+S21Matrix RandomSparse(int rows, int cols, int density, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> pick(0, density - 1);
+  std::uniform_real_distribution<double> value(-2., 2.);
+  S21Matrix m(rows, cols);
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      if (pick(gen) == 0) m(i, j) = value(gen);
+    }
+  }
+  return m;
+}
+
+}  // namespace
+
+TEST(Sparse, dense_round_trip) {
+  S21Matrix dense = RandomSparse(37, 53, 10, 1);
+  S21SparseMatrix sparse(dense);
+  EXPECT_EQ(sparse.getRows(), 37);
+  EXPECT_EQ(sparse.getCols(), 53);
+  EXPECT_LT(sparse.nonZeros(), 37u * 53u / 5);
+  EXPECT_TRUE(sparse.toDense() == dense);
+  EXPECT_EQ(sparse.getElem(5, 7), dense(5, 7));
+  EXPECT_THROW(sparse.getElem(37, 0), std::out_of_range);
+}
+
+TEST(Sparse, construction) {
+  S21SparseMatrix m = S21SparseMatrix::fromTriplets(
+      3, 4, {{2, 1, 5.}, {0, 3, 1.}, {2, 1, 2.}, {1, 0, 4.}, {1, 2, 0.}});
+  EXPECT_EQ(m.nonZeros(), 3u);
+  EXPECT_EQ(m.getElem(2, 1), 7.);
+  EXPECT_EQ(m.rowPointers(), (std::vector<int>{0, 1, 2, 3}));
+  EXPECT_EQ(m.colIndices(), (std::vector<int>{3, 0, 1}));
+
+  S21SparseMatrix csr(2, 3, {0, 2, 3}, {0, 2, 1}, {1., 2., 3.});
+  EXPECT_EQ(csr.getElem(0, 2), 2.);
+  EXPECT_THROW(S21SparseMatrix(2, 3, {0, 2, 3}, {2, 0, 1}, {1., 2., 3.}),
+               std::invalid_argument);
+  EXPECT_THROW(S21SparseMatrix(2, 3, {0, 2}, {0, 1}, {1., 2.}),
+               std::invalid_argument);
+  EXPECT_THROW(S21SparseMatrix::fromTriplets(2, 2, {{2, 0, 1.}}),
+               std::out_of_range);
+}
+
+TEST(Sparse, arithmetic_matches_dense) {
+  S21Matrix a = RandomSparse(40, 30, 6, 2);
+  S21Matrix b = RandomSparse(40, 30, 6, 3);
+  S21SparseMatrix sa(a), sb(b);
+  EXPECT_TRUE((sa + sb).toDense() == S21Matrix(a + b));
+  EXPECT_TRUE((sa - sb).toDense() == S21Matrix(a - b));
+  EXPECT_TRUE((sa * 3.).toDense() == S21Matrix(a * 3.));
+  EXPECT_EQ((sa - sa).nonZeros(), 0u);
+  EXPECT_TRUE(sa.Transpose().toDense() == a.Transpose());
+  EXPECT_FALSE(sa == sb);
+  EXPECT_THROW(sa += sa.Transpose(), std::invalid_argument);
+}
+
+TEST(Sparse, multiply_matches_dense) {
+  S21Matrix a = RandomSparse(60, 45, 8, 4);
+  S21Matrix b = RandomSparse(45, 70, 8, 5);
+  S21Matrix dense = RandomSparse(45, 20, 1, 6);
+  S21SparseMatrix sa(a), sb(b);
+
+  S21SparseMatrix product = sa * sb;
+  EXPECT_TRUE(product.toDense() == a * b);
+  const auto& rowPtr = product.rowPointers();
+  for (int i = 0; i < product.getRows(); ++i) {
+    for (int p = rowPtr[i] + 1; p < rowPtr[i + 1]; ++p)
+      ASSERT_LT(product.colIndices()[p - 1], product.colIndices()[p]);
+  }
+  EXPECT_TRUE(sa * dense == a * dense);
+  EXPECT_TRUE(dense.Transpose() * sb == dense.Transpose() * b);
+  EXPECT_THROW(sa * sa, std::invalid_argument);
+}
+
+TEST(Sparse, csc) {
+  S21Matrix a = RandomSparse(20, 9, 4, 7);
+  S21SparseMatrix csr(a);
+  S21CscMatrix csc(csr);
+  EXPECT_EQ(csc.getRows(), 20);
+  EXPECT_EQ(csc.getCols(), 9);
+  EXPECT_EQ(csc.colPointers().size(), 10u);
+  EXPECT_EQ(csc.nonZeros(), csr.nonZeros());
+  for (int j = 0; j < 9; ++j) {
+    for (int p = csc.colPointers()[j]; p < csc.colPointers()[j + 1]; ++p)
+      EXPECT_EQ(csc.values()[p], a(csc.rowIndices()[p], j));
+  }
+  EXPECT_EQ(csc.getElem(3, 4), a(3, 4));
+  EXPECT_TRUE(csc.toCsr() == csr);
+}
@@ -0,0 +1,93 @@
+#include <cmath>
+#include <random>
+
+#include "../s21_strassen.h"
+#include "tests.h"
+
+namespace {
+
+// Временная смена порога перехода на время теста
+class Crossover {
+ public:
+  explicit Crossover(int value) : saved_(s21::strassen::GetCrossover()) {
+    s21::strassen::SetCrossover(value);
+  }
+  ~Crossover() { s21::strassen::SetCrossover(saved_); }
+
+ private:
+  int saved_;
+};
+
+S21Matrix Random(int rows, int cols, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(-1., 1.);
+  S21Matrix m(rows, cols);
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) m(i, j) = dist(gen);
+  }
+  return m;
+}
+
+double MaxDiff(const S21Matrix& a, const S21Matrix& b) {
+  double diff = 0.;
+  for (int i = 0; i < a.getRows(); ++i) {
+    for (int j = 0; j < a.getCols(); ++j)
+      diff = std::max(diff, std::fabs(a(i, j) - b(i, j)));
+  }
+  return diff;
+}
+
+// Допуск из s21_strassen.h для элементов из [-1, 1]
+double Tolerance(int k, int levels) {
+  return 1e-15 * k * std::pow(12., levels);
+}
+
+}  // namespace
+
+TEST(Strassen, matches_classic_even) {
+  Crossover crossover(16);
+  S21Matrix a = Random(128, 128, 1);
+  S21Matrix b = Random(128, 128, 2);
+  S21Matrix classic(a);
+  classic.MulMatrix(b);
+  a.MulMatrix(b, S21MulAlgorithm::kStrassen);
+  EXPECT_LE(MaxDiff(a, classic), Tolerance(128, 3));
+}
+
+TEST(Strassen, matches_classic_odd) {
+  Crossover crossover(16);
+  S21Matrix a = Random(101, 77, 3);
+  S21Matrix b = Random(77, 53, 4);
+  S21Matrix classic(a);
+  classic.MulMatrix(b);
+  a.MulMatrix(b, S21MulAlgorithm::kStrassen);
+  ASSERT_EQ(a.getRows(), 101);
+  ASSERT_EQ(a.getCols(), 53);
+  EXPECT_LE(MaxDiff(a, classic), Tolerance(77, 2));
+}
+
+TEST(Strassen, exact_on_integers) {
+  Crossover crossover(16);
+  S21Matrix a(64, 64), b(64, 64);
+  for (int i = 0; i < 64; ++i) {
+    for (int j = 0; j < 64; ++j) {
+      a(i, j) = (i * 7 + j * 3) % 11 - 5;
+      b(i, j) = (i * 5 + j) % 13 - 6;
+    }
+  }
+  S21Matrix classic = a * b;
+  a.MulMatrix(b, S21MulAlgorithm::kStrassen);
+  EXPECT_EQ(MaxDiff(a, classic), 0.);
+}
+
+TEST(Strassen, errors) {
+  EXPECT_THROW(s21::strassen::SetCrossover(8), std::invalid_argument);
+  S21Matrix a(3, 4), b(3, 4);
+  EXPECT_THROW(a.MulMatrix(b, S21MulAlgorithm::kStrassen),
+               std::invalid_argument);
+  S21Matrix c(4, 2);
+  c.fillMatrix(1.);
+  a.fillMatrix(2.);
+  a.MulMatrix(c, S21MulAlgorithm::kClassic);
+  EXPECT_EQ(a(2, 1), 8.);
+}
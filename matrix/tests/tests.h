@@ -0,0 +1,8 @@
+#ifndef TESTS_H
+#define TESTS_H
+
+#include <gtest/gtest.h>
+
+#include "../s21_matrix_oop.h"
+
+#endif  // TESTS_H
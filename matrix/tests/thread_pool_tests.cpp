@@ -0,0 +1,156 @@
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../s21_lu.h"
+#include "../s21_thread_pool.h"
+#include "tests.h"
+
+namespace {
+
+constexpr int kThreads = 4;
+
+// Пул из kThreads потоков на время теста независимо от числа ядер машины
+class ThreadPoolTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    saved_ = pool().getThreadCount();
+    pool().setThreadCount(kThreads);
+  }
+  void TearDown() override { pool().setThreadCount(saved_); }
+
+  static S21ThreadPool& pool() { return S21ThreadPool::instance(); }
+
+ private:
+  int saved_ = 0;
+};
+
+S21Matrix Random(int rows, int cols, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> value(-1., 1.);
+  S21Matrix m(rows, cols);
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) m(i, j) = value(gen);
+  }
+  return m;
+}
+
+}  // namespace
+
+TEST_F(ThreadPoolTest, parallel_for) {
+  EXPECT_EQ(pool().getThreadCount(), kThreads);
+
+  // Каждый индекс обрабатывается ровно один раз
+  std::vector<std::atomic<int>> hits(1000);
+  pool().parallelFor(1000, 7, [&](int begin, int end) {
+    EXPECT_LE(end - begin, 7);
+    for (int i = begin; i < end; ++i) ++hits[i];
+  });
+  for (const auto& hit : hits) EXPECT_EQ(hit.load(), 1);
+
+  // Отрезки выполняются одновременно: первый ждёт, пока другой поток
+  // не возьмёт следующий
+  std::atomic<int> entered{0};
+  std::atomic<int> concurrent{0};
+  pool().parallelFor(kThreads, 1, [&](int, int) {
+    ++entered;
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (entered.load() < 2 && std::chrono::steady_clock::now() < deadline)
+      std::this_thread::yield();
+    concurrent = std::max(concurrent.load(), entered.load());
+  });
+  EXPECT_GE(concurrent.load(), 2);
+
+  pool().parallelFor(0, 1, [](int, int) { FAIL(); });
+  EXPECT_THROW(pool().setThreadCount(-1), std::invalid_argument);
+}
+
+TEST_F(ThreadPoolTest, exception) {
+  // Исключение из задачи получает вызывающий поток, пул остаётся рабочим
+  for (int round = 0; round < 10; ++round) {
+    EXPECT_THROW(pool().parallelFor(1000, 1,
+                                    [](int begin, int) {
+                                      if (begin == 500)
+                                        throw std::runtime_error("task");
+                                    }),
+                 std::runtime_error);
+  }
+  std::atomic<int> sum{0};
+  pool().parallelFor(100, 3, [&](int begin, int end) {
+    for (int i = begin; i < end; ++i) sum += i;
+  });
+  EXPECT_EQ(sum.load(), 4950);
+}
+
+TEST_F(ThreadPoolTest, nested) {
+  // Вложенный цикл выполняется в потоке задачи одним вызовом
+  std::atomic<long> sum{0};
+  std::atomic<int> innerCalls{0};
+  pool().parallelFor(64, 1, [&](int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+      pool().parallelFor(100, 1, [&](int b, int e) {
+        EXPECT_EQ(b, 0);
+        EXPECT_EQ(e, 100);
+        ++innerCalls;
+        for (int j = b; j < e; ++j) sum += j;
+      });
+    }
+  });
+  EXPECT_EQ(innerCalls.load(), 64);
+  EXPECT_EQ(sum.load(), 64 * 4950);
+}
+
+TEST_F(ThreadPoolTest, thread_limit) {
+  {
+    S21ThreadLimit limit(2);
+    EXPECT_EQ(pool().getThreadCount(), 2);
+    {
+      S21ThreadLimit unlimited(0);
+      EXPECT_EQ(pool().getThreadCount(), kThreads);
+    }
+    EXPECT_EQ(pool().getThreadCount(), 2);
+    {
+      // Один поток: тело вызывается один раз в вызывающем потоке
+      S21ThreadLimit serial(1);
+      const auto caller = std::this_thread::get_id();
+      int calls = 0;
+      pool().parallelFor(1000, 1, [&](int begin, int end) {
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+        EXPECT_EQ(begin, 0);
+        EXPECT_EQ(end, 1000);
+        ++calls;
+      });
+      EXPECT_EQ(calls, 1);
+    }
+    EXPECT_EQ(pool().getThreadCount(), 2);
+  }
+  EXPECT_EQ(pool().getThreadCount(), kThreads);
+  EXPECT_THROW(S21ThreadLimit(-1), std::invalid_argument);
+  EXPECT_EQ(pool().getThreadCount(), kThreads);
+}
+
+TEST_F(ThreadPoolTest, matches_single_thread) {
+  // Размеры больше порогов распараллеливания GEMM и LU
+  const S21Matrix a = Random(300, 280, 1);
+  const S21Matrix b = Random(280, 310, 2);
+  const S21Matrix square = Random(260, 260, 3);
+
+  S21Matrix product, inverse;
+  double determinant;
+  {
+    S21ThreadLimit serial(1);
+    product = a * b;
+    inverse = S21Matrix(square).InverseMatrix();
+    determinant = S21Matrix(square).Determinant();
+  }
+  EXPECT_TRUE(a * b == product);
+  EXPECT_TRUE(S21Matrix(square).InverseMatrix() == inverse);
+  EXPECT_NEAR(S21Matrix(square).Determinant(), determinant,
+              1e-10 * std::abs(determinant));
+  const S21Matrix rhs = Random(260, 3, 4);
+  EXPECT_TRUE(S21LU(square).solve(rhs) == inverse * rhs);
+}
@@ -0,0 +1,55 @@
+#include "tests.h"
+
+namespace {
+
+S21Matrix Indexed(int rows, int cols) {
+  S21Matrix m(rows, cols);
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) m(i, j) = 1000 * i + j;
+  }
+  return m;
+}
+
+bool IsTransposeOf(const S21Matrix& t, const S21Matrix& m) {
+  if (t.getRows() != m.getCols() || t.getCols() != m.getRows()) return false;
+  for (int i = 0; i < m.getRows(); ++i) {
+    for (int j = 0; j < m.getCols(); ++j) {
+      if (t(j, i) != m(i, j)) return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+TEST(Transpose, rectangular) {
+  // Размеры меньше плитки, не кратные ей и больше листа рекурсии
+  const int sizes[][2] = {{1, 1}, {1, 9}, {3, 5}, {8, 8}, {37, 71}, {130, 67}};
+  for (const auto& size : sizes) {
+    S21Matrix m = Indexed(size[0], size[1]);
+    EXPECT_TRUE(IsTransposeOf(m.Transpose(), m)) << size[0] << "x" << size[1];
+  }
+}
+
+TEST(Transpose, parallel_strips) {
+  S21Matrix m = Indexed(300, 1100);
+  EXPECT_TRUE(IsTransposeOf(m.Transpose(), m));
+}
+
+TEST(Transpose, in_place_square) {
+  for (int n : {1, 7, 8, 33, 100, 520}) {
+    S21Matrix m = Indexed(n, n);
+    S21Matrix copy(m);
+    m.TransposeInPlace();
+    EXPECT_TRUE(IsTransposeOf(m, copy)) << n;
+    m.TransposeInPlace();
+    EXPECT_TRUE(m == copy) << n;
+  }
+}
+
+TEST(Transpose, in_place_rectangular) {
+  S21Matrix m = Indexed(3, 17);
+  S21Matrix copy(m);
+  m.TransposeInPlace();
+  EXPECT_TRUE(IsTransposeOf(m, copy));
+}
@@ -0,0 +1,101 @@
+#include "tests.h"
+
+namespace {
+
+// Матрица rows x cols с элементами 10 * i + j
+S21Matrix Indexed(int rows, int cols) {
+  S21Matrix m(rows, cols);
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) m(i, j) = 10 * i + j;
+  }
+  return m;
+}
+
+}  // namespace
+
+TEST(View, slices_share_storage) {
+  S21Matrix m = Indexed(4, 5);
+  S21MatrixView block = m.Submatrix(1, 2, 2, 3);
+  EXPECT_EQ(block.getRows(), 2);
+  EXPECT_EQ(block.getCols(), 3);
+  EXPECT_EQ(block(1, 2), 24.);
+  block(0, 0) = -1.;
+  EXPECT_EQ(m(1, 2), -1.);
+
+  EXPECT_EQ(m.RowSlice(3)(0, 4), 34.);
+  EXPECT_EQ(m.ColSlice(1)(2, 0), 21.);
+  S21MatrixView t = m.TransposeView();
+  EXPECT_EQ(t.getRows(), 5);
+  EXPECT_EQ(t(4, 3), 34.);
+  EXPECT_EQ(t.Submatrix(1, 0, 2, 2)(1, 0), 2.);
+  EXPECT_THROW(m.Submatrix(3, 0, 2, 1), std::out_of_range);
+  EXPECT_THROW(t(5, 0), std::out_of_range);
+}
+
+TEST(View, operations_accept_views) {
+  S21Matrix m = Indexed(4, 4);
+  S21Matrix a(2, 2);
+  a.fillMatrix(1.);
+  a.SumMatrix(m.Submatrix(2, 2, 2, 2));
+  EXPECT_EQ(a(1, 0), 33.);
+  a.SubMatrix(m.Submatrix(2, 2, 2, 2).TransposeView());
+  EXPECT_EQ(a(1, 0), 33. - 23.);
+
+  S21Matrix t(m.TransposeView());
+  EXPECT_TRUE(t.EqMatrix(m.TransposeView()));
+  EXPECT_TRUE(t == m.TransposeView());
+  EXPECT_FALSE(m == m.TransposeView());
+
+  S21Matrix sum = m.RowSlice(0) + m.RowSlice(1) * 2.;
+  EXPECT_EQ(sum(0, 3), 3. + 2. * 13.);
+}
+
+TEST(View, multiply_without_copies) {
+  S21Matrix m = Indexed(5, 3);
+  S21Matrix gram = m.TransposeView() * m;
+  ASSERT_EQ(gram.getRows(), 3);
+  ASSERT_EQ(gram.getCols(), 3);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      double expected = 0.;
+      for (int p = 0; p < 5; ++p) expected += m(p, i) * m(p, j);
+      EXPECT_EQ(gram(i, j), expected);
+    }
+  }
+
+  // Произведение блоков записывается в блок той же матрицы
+  S21Matrix big = Indexed(6, 6);
+  S21Matrix expected = big.Submatrix(0, 0, 3, 3) * big.Submatrix(3, 3, 3, 3);
+  big.Submatrix(0, 3, 3, 3) =
+      big.Submatrix(0, 0, 3, 3) * big.Submatrix(3, 3, 3, 3);
+  EXPECT_TRUE(big.Submatrix(0, 3, 3, 3) == expected);
+  EXPECT_EQ(big(0, 0), 0.);
+
+  S21Matrix acc(3, 3);
+  acc.MulAddMatrix(big.Submatrix(3, 0, 3, 2), big.Submatrix(0, 3, 2, 3));
+  EXPECT_EQ(acc(0, 0), 30. * big(0, 3) + 31. * big(1, 3));
+  EXPECT_THROW(acc.MulAddMatrix(big.RowSlice(0), big.RowSlice(1)),
+               std::invalid_argument);
+}
+
+TEST(View, overlapping_assignment) {
+  S21Matrix m = Indexed(3, 3);
+  m = m.TransposeView();
+  EXPECT_EQ(m(0, 2), 20.);
+  EXPECT_EQ(m(2, 0), 2.);
+
+  S21Matrix n = Indexed(3, 3);
+  n.Submatrix(1, 0, 2, 3) = n.Submatrix(0, 0, 2, 3);
+  EXPECT_EQ(n(2, 1), 11.);
+  EXPECT_EQ(n(1, 1), 1.);
+
+  S21Matrix k = Indexed(2, 2);
+  k += k.TransposeView();
+  EXPECT_EQ(k(0, 1), 11.);
+  EXPECT_EQ(k(1, 0), 11.);
+  k.RowSlice(0) *= 2.;
+  k.ColSlice(1).fillMatrix(0.);
+  EXPECT_EQ(k(0, 0), 0.);
+  EXPECT_EQ(k(1, 1), 0.);
+  EXPECT_EQ(k(1, 0), 11.);
+}
@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../s21_containers.h"
+
+// Множество короткоживущих векторов: за итерацию создаётся пачка из
+// kBatch векторов по k элементов, которые затем разом уничтожаются. Счётчик
+// vectors/s — созданных и уничтоженных векторов в секунду
+namespace {
+
+constexpr int kBatch = 1024;
+
+// Строка длиннее буфера короткой строки: каждый элемент выделяет память
+constexpr const char *kText = "string longer than the SSO buffer";
+
+template <class Vec, class Make, class Reset>
+void ShortLived(benchmark::State &state, Make make, Reset reset) {
+  const int k = state.range(0);
+  std::vector<Vec> batch;
+  batch.reserve(kBatch);
+  for (auto _ : state) {
+    for (int i = 0; i < kBatch; ++i) {
+      Vec &v = batch.emplace_back(make());
+      for (int j = 0; j < k; ++j) {
+        if constexpr (std::is_same_v<typename Vec::value_type, int>) {
+          v.push_back(j);
+        } else {
+          v.emplace_back(kText);
+        }
+      }
+      benchmark::DoNotOptimize(v.data());
+    }
+    batch.clear();
+    reset();
+  }
+  state.counters["vectors/s"] = benchmark::Counter(
+      kBatch, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// s21::vector с std::allocator: каждое перевыделение — обращение к куче
+template <class T>
+void BM_Heap(benchmark::State &state) {
+  ShortLived<s21::vector<T>>(
+      state, [] { return s21::vector<T>(); }, [] {});
+}
+BENCHMARK_TEMPLATE(BM_Heap, int)->RangeMultiplier(4)->Range(4, 256);
+BENCHMARK_TEMPLATE(BM_Heap, std::string)->RangeMultiplier(4)->Range(4, 256);
+
+// s21::pmr::vector в монотонной арене, сбрасываемой после каждой пачки
+template <class T>
+void BM_Arena(benchmark::State &state) {
+  s21::pmr::monotonic_arena arena;
+  ShortLived<s21::pmr::vector<T>>(
+      state, [&arena] { return s21::pmr::vector<T>(&arena); },
+      [&arena] { arena.reset(); });
+}
+BENCHMARK_TEMPLATE(BM_Arena, int)->RangeMultiplier(4)->Range(4, 256);
+BENCHMARK_TEMPLATE(BM_Arena, std::pmr::string)
+    ->RangeMultiplier(4)
+    ->Range(4, 256);
+
+// То же со стандартным std::pmr::monotonic_buffer_resource: release()
+// возвращает блоки вышестоящему ресурсу, и каждая пачка выделяет их заново
+template <class T>
+void BM_MonotonicBuffer(benchmark::State &state) {
+  std::pmr::monotonic_buffer_resource resource;
+  ShortLived<s21::pmr::vector<T>>(
+      state, [&resource] { return s21::pmr::vector<T>(&resource); },
+      [&resource] { resource.release(); });
+}
+BENCHMARK_TEMPLATE(BM_MonotonicBuffer, int)
+    ->RangeMultiplier(4)
+    ->Range(4, 256);
+BENCHMARK_TEMPLATE(BM_MonotonicBuffer, std::pmr::string)
+    ->RangeMultiplier(4)
+    ->Range(4, 256);
+
+// Встроенный буфер на 16 элементов: векторы длиннее переходят в кучу
+void BM_SmallVector(benchmark::State &state) {
+  ShortLived<s21::small_vector<int, 16>>(
+      state, [] { return s21::small_vector<int, 16>(); }, [] {});
+}
+BENCHMARK(BM_SmallVector)->RangeMultiplier(4)->Range(4, 256);
+
+}  // namespace
+
+BENCHMARK_MAIN();
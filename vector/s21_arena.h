@@ -0,0 +1,189 @@
+#ifndef S21ARENA_H
+#define S21ARENA_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+
+namespace s21 {
+namespace pmr {
+
+// Монотонная арена для множества короткоживущих контейнеров, например
+// s21::pmr::vector, которые создаются и уничтожаются пачками. Память
+// выделяется сдвигом указателя в блоках, полученных у вышестоящего ресурса;
+// освобождение отдельных выделений ничего не делает. reset() разом
+// возвращает всю память арене: несколько блоков заменяются одним общего
+// размера, поэтому после прогрева повторяющийся набор выделений не
+// обращается к вышестоящему ресурсу. Начальный буфер пользователя, если он
+// передан, заполняется первым и вышестоящему ресурсу не возвращается.
+//
+// Арена не потокобезопасна, а контейнеры из неё должны быть уничтожены до
+// вызова reset(), release() и деструктора
+class monotonic_arena final : public std::pmr::memory_resource {
+ public:
+  // Минимальный размер блока, запрашиваемого у вышестоящего ресурса
+  static constexpr std::size_t kMinChunk = std::size_t(1) << 12;
+
+  // Конструкторы и деструктор
+  explicit monotonic_arena(std::pmr::memory_resource *upstream =
+                               std::pmr::get_default_resource()) noexcept;
+  monotonic_arena(void *buffer, std::size_t size,
+                  std::pmr::memory_resource *upstream =
+                      std::pmr::get_default_resource()) noexcept;
+  monotonic_arena(const monotonic_arena &) = delete;
+  monotonic_arena &operator=(const monotonic_arena &) = delete;
+  ~monotonic_arena() override;
+
+  void reset() noexcept;    // Освобождение всех выделений
+  void release() noexcept;  // Возврат блоков вышестоящему ресурсу
+  std::size_t capacity() const noexcept;  // Байт в буфере и во всех блоках
+  std::pmr::memory_resource *upstream_resource() const noexcept;
+
+ private:
+  // Заголовок в начале блока; блоки связаны в порядке заполнения
+  struct alignas(std::max_align_t) Chunk {
+    Chunk *next;
+    std::size_t size;  // Размер вместе с заголовком
+  };
+
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void *p, std::size_t bytes,
+                     std::size_t alignment) override;
+  bool do_is_equal(
+      const std::pmr::memory_resource &other) const noexcept override;
+
+  void *allocateSlow(std::size_t bytes, std::size_t alignment);
+  void freeChunks() noexcept;
+  void rewind() noexcept;
+
+  std::pmr::memory_resource *upstream_;
+  char *buffer_;               // Начальный буфер пользователя
+  std::size_t buffer_size_;
+  Chunk *chunks_ = nullptr;    // Первый блок
+  Chunk *current_ = nullptr;   // Заполняемый блок, nullptr — буфер
+  char *ptr_;                  // Начало свободного места
+  char *end_;                  // Конец заполняемого блока
+  std::size_t next_size_ = kMinChunk;  // Размер следующего нового блока
+};
+
+//  ----------------------------------------------------------------------
+
+inline monotonic_arena::monotonic_arena(
+    std::pmr::memory_resource *upstream) noexcept
+    : monotonic_arena(nullptr, 0U, upstream) {}
+
+inline monotonic_arena::monotonic_arena(
+    void *buffer, std::size_t size,
+    std::pmr::memory_resource *upstream) noexcept
+    : upstream_(upstream),
+      buffer_(static_cast<char *>(buffer)),
+      buffer_size_(size),
+      ptr_(buffer_),
+      end_(buffer_ + size) {}
+
+inline monotonic_arena::~monotonic_arena() { freeChunks(); }
+
+// Несколько блоков заменяются одним общего размера, чтобы следующий такой
+// же набор выделений поместился без запросов к вышестоящему ресурсу
+inline void monotonic_arena::reset() noexcept {
+  if (chunks_ && chunks_->next) {
+    std::size_t total = 0;
+    for (Chunk *chunk = chunks_; chunk; chunk = chunk->next)
+      total += chunk->size;
+    freeChunks();
+    try {
+      void *p = upstream_->allocate(total, alignof(Chunk));
+      chunks_ = ::new (p) Chunk{nullptr, total};
+    } catch (const std::bad_alloc &) {
+      // Блок будет выделен заново при следующем запросе
+    }
+  }
+  rewind();
+}
+
+inline void monotonic_arena::release() noexcept {
+  freeChunks();
+  next_size_ = kMinChunk;
+  rewind();
+}
+
+inline std::size_t monotonic_arena::capacity() const noexcept {
+  std::size_t total = buffer_size_;
+  for (Chunk *chunk = chunks_; chunk; chunk = chunk->next)
+    total += chunk->size - sizeof(Chunk);
+  return total;
+}
+
+inline std::pmr::memory_resource *monotonic_arena::upstream_resource()
+    const noexcept {
+  return upstream_;
+}
+
+// Быстрый путь — сдвиг указателя в заполняемом блоке
+inline void *monotonic_arena::do_allocate(std::size_t bytes,
+                                          std::size_t alignment) {
+  bytes = std::max<std::size_t>(bytes, 1U);
+  void *p = ptr_;
+  std::size_t space = end_ - ptr_;
+  if (std::align(alignment, bytes, p, space)) {
+    ptr_ = static_cast<char *>(p) + bytes;
+    return p;
+  }
+  return allocateSlow(bytes, alignment);
+}
+
+// Переход к следующему блоку, оставшемуся после reset(), а при его
+// отсутствии — новый блок вдвое больше предыдущего
+inline void *monotonic_arena::allocateSlow(std::size_t bytes,
+                                           std::size_t alignment) {
+  for (;;) {
+    Chunk *next = current_ ? current_->next : chunks_;
+    if (!next) {
+      const std::size_t size =
+          std::max(next_size_, sizeof(Chunk) + bytes + alignment);
+      next = ::new (upstream_->allocate(size, alignof(Chunk)))
+          Chunk{nullptr, size};
+      (current_ ? current_->next : chunks_) = next;
+      next_size_ = 2 * size;
+    }
+    current_ = next;
+    ptr_ = reinterpret_cast<char *>(next + 1);
+    end_ = reinterpret_cast<char *>(next) + next->size;
+
+    void *p = ptr_;
+    std::size_t space = end_ - ptr_;
+    if (std::align(alignment, bytes, p, space)) {
+      ptr_ = static_cast<char *>(p) + bytes;
+      return p;
+    }
+  }
+}
+
+inline void monotonic_arena::do_deallocate(void *, std::size_t,
+                                           std::size_t) {}
+
+inline bool monotonic_arena::do_is_equal(
+    const std::pmr::memory_resource &other) const noexcept {
+  return this == &other;
+}
+
+inline void monotonic_arena::freeChunks() noexcept {
+  while (chunks_) {
+    Chunk *next = chunks_->next;
+    upstream_->deallocate(chunks_, chunks_->size, alignof(Chunk));
+    chunks_ = next;
+  }
+}
+
+// Заполнение снова начинается с начального буфера
+inline void monotonic_arena::rewind() noexcept {
+  current_ = nullptr;
+  ptr_ = buffer_;
+  end_ = buffer_ + buffer_size_;
+}
+
+}  // namespace pmr
+}  // namespace s21
+#endif
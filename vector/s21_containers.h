@@ -1,6 +1,8 @@
 #ifndef S21_CONTAINERS_H
 #define S21_CONTAINERS_H
 
+#include "s21_arena.h"
+#include "s21_small_vector.h"
 #include "s21_vector.h"
 
 #endif  // S21_CONTAINERS_H
\ No newline at end of file
@@ -0,0 +1,154 @@
+#ifndef S21SMALLVECTOR_H
+#define S21SMALLVECTOR_H
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Вектор со встроенным буфером на N элементов: пока элементов не больше N,
+// память не выделяется. При переполнении элементы переносятся в кучу, и
+// дальше вектор растёт как s21::vector; обратно во встроенный буфер они не
+// возвращаются. Интерфейс тот же, что у s21::vector, и small_vector можно
+// передавать туда, где ожидается ссылка на s21::vector<T, Allocator>.
+// Распределитель выделяет память только после переполнения
+template <class T, size_t N, class Allocator = std::allocator<T>>
+class small_vector : public vector<T, Allocator> {
+  static_assert(N > 0, "small_vector needs inline capacity");
+  using Base = vector<T, Allocator>;
+
+ public:
+  // Определение типов
+  using typename Base::allocator_type;
+  using typename Base::value_type;
+  using typename Base::reference;
+  using typename Base::const_reference;
+  using typename Base::iterator;
+  using typename Base::const_iterator;
+  using typename Base::size_type;
+
+  static constexpr size_type inline_capacity = N;
+
+  // Конструкторы и деструктор
+  small_vector() noexcept(noexcept(Allocator()));  // Конструктор по умолчанию
+  explicit small_vector(const Allocator &alloc) noexcept;
+  explicit small_vector(
+      size_type n,
+      const Allocator &alloc = Allocator());  // Конструктор с размером
+  small_vector(std::initializer_list<value_type> const &items,
+               const Allocator &alloc =
+                   Allocator());  // Конструктор со списком инициализации
+  small_vector(const small_vector &v);  // Конструктор копирования
+  // Конструктор перемещения: буфер в куче забирается, элементы встроенного
+  // буфера переносятся во встроенный буфер без выделения памяти
+  small_vector(small_vector &&v) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>);
+  ~small_vector();  // Деструктор
+
+  // Операторы
+  small_vector &operator=(const small_vector &v);  // Присваивание копированием
+  small_vector &operator=(small_vector &&v);  // Присваивание с перемещением
+
+  // Обмен без выделения памяти, если оба вектора во встроенных буферах
+  void swap(small_vector &other);
+
+  bool is_inline() const noexcept;  // Элементы во встроенном буфере
+
+ private:
+  value_type *buffer() noexcept;
+  void reclaimBuffer() noexcept;
+
+  alignas(value_type) unsigned char storage_[N * sizeof(value_type)];
+};
+
+template <class T, size_t N, class Allocator>
+small_vector<T, N, Allocator>::small_vector() noexcept(noexcept(Allocator()))
+    : small_vector(Allocator()) {}
+
+template <class T, size_t N, class Allocator>
+small_vector<T, N, Allocator>::small_vector(const Allocator &alloc) noexcept
+    : Base(reinterpret_cast<value_type *>(storage_), N, alloc) {}
+
+template <class T, size_t N, class Allocator>
+small_vector<T, N, Allocator>::small_vector(size_type n,
+                                            const Allocator &alloc)
+    : small_vector(alloc) {
+  this->reserve(n);
+  for (size_type i = 0; i < n; ++i) this->emplace_back();
+}
+
+template <class T, size_t N, class Allocator>
+small_vector<T, N, Allocator>::small_vector(
+    std::initializer_list<value_type> const &items, const Allocator &alloc)
+    : small_vector(alloc) {
+  this->append(items.begin(), items.end());
+}
+
+template <class T, size_t N, class Allocator>
+small_vector<T, N, Allocator>::small_vector(const small_vector &v)
+    : small_vector(std::allocator_traits<
+                   Allocator>::select_on_container_copy_construction(
+          v.get_allocator())) {
+  this->append(v.begin(), v.end());
+}
+
+template <class T, size_t N, class Allocator>
+small_vector<T, N, Allocator>::small_vector(small_vector &&v) noexcept(
+    std::is_nothrow_move_constructible_v<value_type>)
+    : small_vector(v.get_allocator()) {
+  Base::operator=(std::move(v));
+  v.reclaimBuffer();
+}
+
+// Элементы разрушаются до того, как встроенный буфер перестанет
+// существовать; память в куче освобождает деструктор s21::vector
+template <class T, size_t N, class Allocator>
+small_vector<T, N, Allocator>::~small_vector() {
+  this->clear();
+}
+
+template <class T, size_t N, class Allocator>
+small_vector<T, N, Allocator> &small_vector<T, N, Allocator>::operator=(
+    const small_vector &v) {
+  Base::operator=(v);
+  return *this;
+}
+
+template <class T, size_t N, class Allocator>
+small_vector<T, N, Allocator> &small_vector<T, N, Allocator>::operator=(
+    small_vector &&v) {
+  if (this != &v) {
+    Base::operator=(std::move(v));
+    v.reclaimBuffer();
+  }
+  return *this;
+}
+
+template <class T, size_t N, class Allocator>
+void small_vector<T, N, Allocator>::swap(small_vector &other) {
+  small_vector tmp(std::move(other));
+  other = std::move(*this);
+  *this = std::move(tmp);
+}
+
+template <class T, size_t N, class Allocator>
+bool small_vector<T, N, Allocator>::is_inline() const noexcept {
+  return this->isInline();
+}
+
+template <class T, size_t N, class Allocator>
+typename small_vector<T, N, Allocator>::value_type *
+small_vector<T, N, Allocator>::buffer() noexcept {
+  return reinterpret_cast<value_type *>(storage_);
+}
+
+// Забранный буфер в куче заменяется встроенным. Если элементы были
+// перенесены к неравному распределителю, свой буфер в куче остаётся у
+// вектора и освобождается его деструктором
+template <class T, size_t N, class Allocator>
+void small_vector<T, N, Allocator>::reclaimBuffer() noexcept {
+  if (!this->isInline() && this->data() == nullptr)
+    this->resetInline(buffer(), N);
+}
+
+}  // namespace s21
+#endif
@@ -1,36 +1,125 @@
 #ifndef S21VECTOR_H
 #define S21VECTOR_H
 
+#include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Во сколько раз растёт емкость, когда push_back и insert не хватает места.
+// Рост в константу раз делает серию из N вставок O(N) по числу копирований
+// элементов; меньший множитель экономит память ценой более частых
+// перевыделений
+#ifndef S21_VECTOR_GROWTH_FACTOR
+#define S21_VECTOR_GROWTH_FACTOR 2.0
+#endif
 
 /*
 HEADER FILE
 */
 namespace s21 {
+
+// Объект можно перенести на новое место побайтовым копированием, после
+// которого старый объект считается прекратившим существование (деструктор
+// для него не вызывается). Верно для тривиально копируемых типов; для
+// своих типов, например владеющих буфером через указатель, трейт можно
+// специализировать
 template <class T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+namespace detail {
+// Ограничивает перегрузку итераторами, чтобы assign(n, value) с целыми
+// аргументами не выбирал версию для диапазона
+template <class It>
+using RequireInputIterator = std::enable_if_t<std::is_convertible_v<
+    typename std::iterator_traits<It>::iterator_category,
+    std::input_iterator_tag>>;
+
+template <class A, class = void>
+struct HasConstruct : std::false_type {};
+template <class A>
+struct HasConstruct<A, std::void_t<decltype(std::declval<A &>().construct(
+                           std::declval<typename A::value_type *>(),
+                           std::declval<typename A::value_type &&>()))>>
+    : std::true_type {};
+
+template <class A, class = void>
+struct HasDestroy : std::false_type {};
+template <class A>
+struct HasDestroy<A, std::void_t<decltype(std::declval<A &>().destroy(
+                         std::declval<typename A::value_type *>()))>>
+    : std::true_type {};
+
+// allocator_traits::construct и destroy распределителя A сводятся к
+// размещающему new и вызову деструктора, и их можно заменить побайтовым
+// копированием: у A нет своих construct и destroy, либо это
+// std::allocator, либо polymorphic_allocator для типа, который сам
+// распределитель не использует
+template <class A, class T = typename A::value_type>
+constexpr bool kPlainConstruct =
+    (!HasConstruct<A>::value && !HasDestroy<A>::value) ||
+    std::is_same_v<A, std::allocator<T>> ||
+    (std::is_same_v<A, std::pmr::polymorphic_allocator<T>> &&
+     !std::uses_allocator_v<T, A>);
+}  // namespace detail
+
+// Распределитель памяти задаётся параметром Allocator и используется только
+// через std::allocator_traits: копия вектора получает распределитель из
+// select_on_container_copy_construction, а при присваивании и обмене он
+// передаётся, если так указано в propagate_on_container_*. Память одного
+// распределителя освобождается только равным ему распределителем, поэтому
+// при перемещении между неравными распределителями, которые не передаются,
+// элементы переносятся по одному. Поддерживаются только обычные указатели
+// (allocator_traits::pointer — T*)
+template <class T, class Allocator = std::allocator<T>>
 class vector {
  public:
   // Определение типов
   using value_type = T;
+  using allocator_type = Allocator;
   using reference = T &;
   using const_reference = const T &;
   using iterator = T *;
   using const_iterator = const T *;
   using size_type = size_t;
 
+  static constexpr double growth_factor = S21_VECTOR_GROWTH_FACTOR;
+  static_assert(growth_factor > 1.0, "S21_VECTOR_GROWTH_FACTOR must be > 1");
+
   // Конструкторы и деструктор
-  vector();  // Конструктор по умолчанию
-  explicit vector(size_type n);  // Конструктор с заданным размером
-  vector(std::initializer_list<value_type> const
-             &items);  // Конструктор со списком инициализации
+  vector() noexcept(noexcept(Allocator()));  // Конструктор по умолчанию
+  explicit vector(const Allocator &alloc) noexcept;
+  explicit vector(
+      size_type n,
+      const Allocator &alloc = Allocator());  // Конструктор с размером
+  vector(std::initializer_list<value_type> const &items,
+         const Allocator &alloc =
+             Allocator());  // Конструктор со списком инициализации
   vector(const vector &v);  // Конструктор копирования
-  vector(vector &&v);       // Конструктор перемещения
-  ~vector();                // Деструктор
+  vector(const vector &v, const Allocator &alloc);
+  // Перемещение не бросает исключений, если буфер забирается целиком:
+  // конструктор — когда все экземпляры распределителя равны, присваивание —
+  // когда распределитель передаётся вместе с буфером или все экземпляры
+  // равны. Исключение — источник small_vector, переданный как vector&&, с
+  // элементами во встроенном буфере: они переносятся по одному, и нехватка
+  // памяти или исключение при копировании элемента вызывает std::terminate
+  vector(vector &&v) noexcept(
+      alloc_traits::is_always_equal::value);  // Конструктор перемещения
+  vector(vector &&v, const Allocator &alloc);
+  ~vector();  // Деструктор
 
   // Операторы
-  reference operator=(vector &&v);  // Оператор присваивания с перемещением
+  vector &operator=(const vector &v);  // Оператор присваивания с копированием
+  vector &operator=(vector &&v) noexcept(
+      kNothrowMoveAssign);  // Оператор присваивания с перемещением
+
+  allocator_type get_allocator() const;  // Копия распределителя
 
   // Методы доступа к элементам
   reference at(size_type pos);  // Доступ к элементу с проверкой на границы
@@ -42,24 +131,48 @@ class vector {
   // Методы для работы с итераторами
   iterator begin();  // Получение итератора на начало
   iterator end();    // Получение итератора на конец
+  const_iterator begin() const;
+  const_iterator end() const;
 
   // Методы для работы с емкостью и размером
   bool empty();      // Проверка на пустоту
   size_type size();  // Получение размера
   size_type max_size();  // Получение максимального размера
-  void reserve(size_type new_capacity);  // Изменение емкости
+  void reserve(size_type new_capacity);  // Установка емкости
   size_type capacity();  // Получение текущей емкости
   void shrink_to_fit();  // Уменьшение емкости до размера
 
   // Модификаторы
   void clear();  // Очистка контейнера
-  iterator insert(iterator pos, const_reference value);  // Вставка элемента
+  iterator insert(const_iterator pos,
+                  const_reference value);  // Вставка элемента
+  iterator insert(const_iterator pos, value_type &&value);
   void erase(iterator pos);  // Удаление элемента
   void push_back(const_reference value);  // Добавление элемента в конец
+  void push_back(value_type &&value);
   void pop_back();  // Удаление последнего элемента
   void swap(vector &other);  // Обмен содержимым с другим вектором
 
-  // Вставка нескольких элементов
+  // Создание элемента на месте из аргументов конструктора
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+
+  // Вставка, добавление в конец и замена содержимого диапазоном. Память
+  // выделяется не более одного раза, хвост сдвигается один раз. Диапазон
+  // не должен указывать на элементы этого же вектора
+  template <class InputIt, class = detail::RequireInputIterator<InputIt>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last);
+  iterator insert(const_iterator pos, std::initializer_list<value_type> items);
+  template <class InputIt, class = detail::RequireInputIterator<InputIt>>
+  void append(InputIt first, InputIt last);
+  template <class InputIt, class = detail::RequireInputIterator<InputIt>>
+  void assign(InputIt first, InputIt last);
+  void assign(size_type n, const_reference value);
+  void assign(std::initializer_list<value_type> items);
+
+  // Вставка нескольких элементов; возвращает итератор на последний из них
   template <typename... Args>
   iterator insert_many(const_iterator pos, Args &&...args);
 
@@ -67,212 +180,766 @@ class vector {
   template <typename... Args>
   void insert_many_back(Args &&...args);
 
+ protected:
+  // Для small_vector: пустой вектор над встроенным буфером наследника на
+  // capacity элементов. Такой буфер не освобождается и не передаётся
+  // другому вектору при перемещении — элементы переносятся по одному
+  vector(value_type *buf, size_type capacity,
+         const Allocator &alloc) noexcept;
+  bool isInline() const noexcept;
+  // Возвращает пустому вектору без памяти встроенный буфер
+  void resetInline(value_type *buf, size_type capacity) noexcept;
+
  private:
+  // Память выделяется без создания элементов: живы только первые size_
+  // элементов буфера, они создаются и разрушаются по одному через
+  // allocator_traits
+  using alloc_traits = std::allocator_traits<allocator_type>;
+  static_assert(std::is_same_v<typename alloc_traits::value_type, T>,
+                "Allocator::value_type must be T");
+  static_assert(std::is_same_v<typename alloc_traits::pointer, T *>,
+                "fancy pointers are not supported");
+
+  // Присваивание с перемещением забирает буфер в куче целиком:
+  // распределитель передаётся вместе с ним или равен распределителю v
+  static constexpr bool kNothrowMoveAssign =
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value;
+
+  // Перенос и сдвиг элементов через memcpy и memmove
+  static constexpr bool kBitwiseRelocate =
+      is_trivially_relocatable<value_type>::value &&
+      std::is_nothrow_move_constructible_v<value_type> &&
+      detail::kPlainConstruct<allocator_type>;
+  // Сдвиг присваиванием с перемещением, если оно не бросает исключений или
+  // копирование невозможно, иначе копированием
+  static constexpr bool kMoveAssign =
+      std::is_nothrow_move_assignable_v<value_type> ||
+      !std::is_copy_assignable_v<value_type>;
+
+  value_type *allocate(size_type n);
+  void deallocate(value_type *p, size_type n);
+  void destroy(value_type *first, value_type *last);
+  template <class Make>
+  void initialize(size_type n, Make make);
+  size_type nextCapacity(size_type required);
+  void relocate(vector &from, value_type *buf, size_type index,
+                size_type gap);
+  void reallocate(size_type new_capacity);
+  void replaceStorage(value_type *buf, size_type new_capacity);
+  void releaseStorage();
+  void dropStorage();
+  void take(vector &v);
+  size_type checkedIndex(const_iterator pos);
+  template <class... Args>
+  void constructEach(value_type *dst, Args &&...args);
+  template <class Make>
+  void growInsert(size_type index, size_type k, Make make);
+  template <class Make>
+  iterator insertN(size_type index, size_type k, Make make);
+  template <size_type K, class Make>
+  iterator insertStaged(size_type index, Make make);
+
   // Приватные члены класса
-  size_t size_;      // Размер вектора
-  size_t capacity_;  // Емкость вектора
-  value_type *arr_;  // Указатель на массив данных
+  allocator_type alloc_;  // Объявлен первым: нужен при инициализации arr_
+  bool inline_ = false;   // arr_ — встроенный буфер small_vector
+  size_t size_;           // Размер вектора
+  size_t capacity_;       // Емкость вектора
+  value_type *arr_;       // Указатель на массив данных
 };
 
-template <class value_type>
-vector<value_type>::vector() : size_(0U), capacity_(0U), arr_(nullptr) {}
+//  -------------------------------------------
 
-template <class value_type>
-vector<value_type>::vector(size_type n) : size_(n), capacity_(n) {
-  if (n > 0) arr_ = new value_type[n];
+template <class value_type, class Allocator>
+value_type *vector<value_type, Allocator>::allocate(size_type n) {
+  return n ? alloc_traits::allocate(alloc_, n) : nullptr;
 }
 
-template <class value_type>
-vector<value_type>::vector(std::initializer_list<value_type> const &items)
-    : size_(items.size()),
-      capacity_(items.size()),
-      arr_(new value_type[items.size()]) {
-  int i = 0;
-  for (auto it = items.begin(); it != items.end(); it++) {
-    arr_[i++] = *it;
+template <class value_type, class Allocator>
+void vector<value_type, Allocator>::deallocate(value_type *p, size_type n) {
+  if (p) alloc_traits::deallocate(alloc_, p, n);
+}
+
+template <class value_type, class Allocator>
+void vector<value_type, Allocator>::destroy(value_type *first,
+                                            value_type *last) {
+  for (; first != last; ++first) alloc_traits::destroy(alloc_, first);
+}
+
+// Создаёт в пустом буфере элементы make(p, i), i < n. Используется только в
+// конструкторах: при исключении созданные элементы разрушаются и буфер
+// освобождается, так как деструктор не будет вызван
+template <class value_type, class Allocator>
+template <class Make>
+void vector<value_type, Allocator>::initialize(size_type n, Make make) {
+  try {
+    for (; size_ < n; ++size_) make(arr_ + size_, size_);
+  } catch (...) {
+    destroy(arr_, arr_ + size_);
+    deallocate(arr_, capacity_);
+    throw;
   }
 }
 
-template <class value_type>
-vector<value_type>::vector(const vector &v)
-    : size_(v.size_),
-      capacity_(v.capacity_),
-      arr_(new value_type[v.capacity_]) {
-  for (size_type i = 0; i < size_; ++i) {
-    arr_[i] = v.arr_[i];
+// Емкость для роста до required элементов: не меньше чем в growth_factor раз
+// больше текущей
+template <class value_type, class Allocator>
+typename vector<value_type, Allocator>::size_type
+vector<value_type, Allocator>::nextCapacity(size_type required) {
+  if (required > max_size())
+    throw std::length_error("vector: too many elements");
+  const double grown = capacity_ * growth_factor;
+  if (grown >= static_cast<double>(max_size())) return max_size();
+  return std::max(required, static_cast<size_type>(grown));
+}
+
+// Переносит элементы вектора from (обычно самого этого вектора) в буфер
+// buf этого вектора, оставляя перед элементом index место под gap новых
+// элементов; после переноса живых элементов в старом буфере не остаётся,
+// но размер from не меняется. Элементы создаются своим распределителем и
+// разрушаются распределителем from. Элементы перемещаются, если
+// перемещение не бросает исключений, иначе копируются: при исключении
+// буфер остаётся пустым, а from — нетронутым
+template <class value_type, class Allocator>
+void vector<value_type, Allocator>::relocate(vector &from, value_type *buf,
+                                             size_type index, size_type gap) {
+  const value_type *src = from.arr_;
+  const size_type size = from.size_;
+  if constexpr (kBitwiseRelocate) {
+    if (index)
+      std::memcpy(static_cast<void *>(buf), src, index * sizeof(value_type));
+    if (size > index)
+      std::memcpy(static_cast<void *>(buf + index + gap), src + index,
+                  (size - index) * sizeof(value_type));
+  } else {
+    value_type *dst = buf;
+    size_type i = 0;
+    try {
+      for (; i < size; ++i, ++dst) {
+        if (i == index) dst += gap;
+        alloc_traits::construct(alloc_, dst,
+                                std::move_if_noexcept(from.arr_[i]));
+      }
+    } catch (...) {
+      destroy(buf, buf + std::min(i, index));
+      if (i > index) destroy(buf + index + gap, dst);
+      throw;
+    }
+    from.destroy(from.arr_, from.arr_ + size);
   }
-};
+}
+
+template <class value_type, class Allocator>
+void vector<value_type, Allocator>::reallocate(size_type new_capacity) {
+  value_type *buf = allocate(new_capacity);
+  try {
+    relocate(*this, buf, size_, 0U);
+  } catch (...) {
+    deallocate(buf, new_capacity);
+    throw;
+  }
+  replaceStorage(buf, new_capacity);
+}
 
-template <class value_type>
-vector<value_type>::vector(vector &&v)
-    : size_(v.size_), capacity_(v.capacity_), arr_(v.arr_) {
-  size_ = std::exchange(v.size_, 0);
-  capacity_ = std::exchange(v.capacity_, 0);
-  arr_ = std::exchange(v.arr_, nullptr);
+// Освобождает старый буфер после relocate и переходит на buf
+template <class value_type, class Allocator>
+void vector<value_type, Allocator>::replaceStorage(value_type *buf,
+                                                   size_type new_capacity) {
+  releaseStorage();
+  arr_ = buf;
+  capacity_ = new_capacity;
+  inline_ = false;
+}
+
+template <class value_type, class Allocator>
+void vector<value_type, Allocator>::releaseStorage() {
+  if (!inline_) deallocate(arr_, capacity_);
+}
+
+// Освобождает память пустого вектора перед сменой распределителя;
+// встроенный буфер распределителю не принадлежит и остаётся
+template <class value_type, class Allocator>
+void vector<value_type, Allocator>::dropStorage() {
+  if (inline_) return;
+  releaseStorage();
+  arr_ = nullptr;
+  capacity_ = 0;
+}
+
+// Забирает элементы v в пустой вектор. Буфер в куче забирается целиком,
+// если его может освободить свой распределитель; из встроенного буфера и
+// из памяти неравного распределителя элементы переносятся в свою память
+template <class value_type, class Allocator>
+void vector<value_type, Allocator>::take(vector &v) {
+  if (v.inline_ || !(alloc_ == v.alloc_)) {
+    if (capacity_ < v.size_) {
+      // Как в reallocate: новый буфер принадлежит вектору только после
+      // успешного переноса, иначе исключение из конструктора его теряет
+      value_type *buf = allocate(v.size_);
+      try {
+        relocate(v, buf, v.size_, 0U);
+      } catch (...) {
+        deallocate(buf, v.size_);
+        throw;
+      }
+      replaceStorage(buf, v.size_);
+    } else {
+      relocate(v, arr_, v.size_, 0U);
+    }
+    size_ = std::exchange(v.size_, 0);
+  } else {
+    releaseStorage();
+    inline_ = false;
+    size_ = std::exchange(v.size_, 0);
+    capacity_ = std::exchange(v.capacity_, 0);
+    arr_ = std::exchange(v.arr_, nullptr);
+  }
+}
+
+template <class value_type, class Allocator>
+vector<value_type, Allocator>::vector(value_type *buf, size_type capacity,
+                                      const Allocator &alloc) noexcept
+    : alloc_(alloc),
+      inline_(true),
+      size_(0U),
+      capacity_(capacity),
+      arr_(buf) {}
+
+template <class value_type, class Allocator>
+bool vector<value_type, Allocator>::isInline() const noexcept {
+  return inline_;
+}
+
+template <class value_type, class Allocator>
+void vector<value_type, Allocator>::resetInline(value_type *buf,
+                                                size_type capacity) noexcept {
+  inline_ = true;
+  capacity_ = capacity;
+  arr_ = buf;
+}
+
+template <class value_type, class Allocator>
+vector<value_type, Allocator>::vector() noexcept(noexcept(Allocator()))
+    : vector(Allocator()) {}
+
+template <class value_type, class Allocator>
+vector<value_type, Allocator>::vector(const Allocator &alloc) noexcept
+    : alloc_(alloc), size_(0U), capacity_(0U), arr_(nullptr) {}
+
+template <class value_type, class Allocator>
+vector<value_type, Allocator>::vector(size_type n, const Allocator &alloc)
+    : alloc_(alloc), size_(0U), capacity_(n), arr_(allocate(n)) {
+  initialize(n, [this](value_type *p, size_type) {
+    alloc_traits::construct(alloc_, p);
+  });
+}
+
+template <class value_type, class Allocator>
+vector<value_type, Allocator>::vector(
+    std::initializer_list<value_type> const &items, const Allocator &alloc)
+    : alloc_(alloc),
+      size_(0U),
+      capacity_(items.size()),
+      arr_(allocate(items.size())) {
+  initialize(items.size(), [this, &items](value_type *p, size_type i) {
+    alloc_traits::construct(alloc_, p, items.begin()[i]);
+  });
+}
+
+template <class value_type, class Allocator>
+vector<value_type, Allocator>::vector(const vector &v)
+    : vector(v, alloc_traits::select_on_container_copy_construction(v.alloc_)) {
+}
+
+template <class value_type, class Allocator>
+vector<value_type, Allocator>::vector(const vector &v, const Allocator &alloc)
+    : alloc_(alloc), size_(0U), capacity_(v.size_), arr_(allocate(v.size_)) {
+  initialize(v.size_, [this, &v](value_type *p, size_type i) {
+    alloc_traits::construct(alloc_, p, v.arr_[i]);
+  });
+}
+
+// Распределитель копируется, а не перемещается: take сравнивает его с
+// распределителем v
+template <class value_type, class Allocator>
+vector<value_type, Allocator>::vector(vector &&v) noexcept(
+    alloc_traits::is_always_equal::value)
+    : alloc_(v.alloc_), size_(0U), capacity_(0U), arr_(nullptr) {
+  take(v);
+}
+
+template <class value_type, class Allocator>
+vector<value_type, Allocator>::vector(vector &&v, const Allocator &alloc)
+    : alloc_(alloc), size_(0U), capacity_(0U), arr_(nullptr) {
+  take(v);
+}
+
+template <class value_type, class Allocator>
+vector<value_type, Allocator> &vector<value_type, Allocator>::operator=(
+    const vector &v) {
+  if (this != &v) {
+    if constexpr (alloc_traits::propagate_on_container_copy_assignment::
+                      value) {
+      if (!(alloc_ == v.alloc_)) {
+        clear();
+        dropStorage();
+      }
+      alloc_ = v.alloc_;
+    }
+    assign(v.begin(), v.end());
+  }
+  return *this;
 }
 
-template <class value_type>
-typename vector<value_type>::reference vector<value_type>::operator=(
-    vector &&v) {
-  size_ = std::exchange(v.size_, 0);
-  capacity_ = std::exchange(v.capacity_, 0);
-  arr_ = std::exchange(v.arr_, nullptr);
+template <class value_type, class Allocator>
+vector<value_type, Allocator> &vector<value_type, Allocator>::operator=(
+    vector &&v) noexcept(kNothrowMoveAssign) {
+  if (this != &v) {
+    clear();
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::
+                      value) {
+      if (!(alloc_ == v.alloc_)) dropStorage();
+      alloc_ = v.alloc_;
+    }
+    take(v);
+  }
   return *this;
 }
 
-template <class value_type>
-vector<value_type>::~vector() {
-  delete[] arr_;
+template <class value_type, class Allocator>
+typename vector<value_type, Allocator>::allocator_type
+vector<value_type, Allocator>::get_allocator() const {
+  return alloc_;
+}
+
+template <class value_type, class Allocator>
+vector<value_type, Allocator>::~vector() {
+  destroy(arr_, arr_ + size_);
+  releaseStorage();
   arr_ = nullptr;
 }
 
-template <class value_type>
-typename vector<value_type>::reference vector<value_type>::at(size_type pos) {
+template <class value_type, class Allocator>
+typename vector<value_type, Allocator>::reference
+vector<value_type, Allocator>::at(size_type pos) {
   if (pos > (*this).size()) throw std::out_of_range("vector.at: out of range");
   return arr_[pos];
 }
 
-template <class value_type>
-typename vector<value_type>::reference vector<value_type>::operator[](
-    size_type pos) {
+template <class value_type, class Allocator>
+typename vector<value_type, Allocator>::reference
+vector<value_type, Allocator>::operator[](size_type pos) {
   return (*this).at(pos);
 }
 
-template <class value_type>
-typename vector<value_type>::const_reference vector<value_type>::front() {
+template <class value_type, class Allocator>
+typename vector<value_type, Allocator>::const_reference
+vector<value_type, Allocator>::front() {
   if ((*this).size() == 0) throw std::out_of_range("front: out_of_range");
   return (*this).at(0);
 }
 
-template <class value_type>
-typename vector<value_type>::const_reference vector<value_type>::back() {
+template <class value_type, class Allocator>
+typename vector<value_type, Allocator>::const_reference
+vector<value_type, Allocator>::back() {
   if ((*this).size() == 0) throw std::out_of_range("back: out_of_range");
   return this->at(size_ - 1);
 }
 
-template <class value_type>
-value_type *vector<value_type>::data() {
+template <class value_type, class Allocator>
+value_type *vector<value_type, Allocator>::data() {
   return arr_;
 }
 
 //  -------------------------------------------
 
-template <class value_type>
-typename vector<value_type>::iterator vector<value_type>::begin() {
+template <class value_type, class Allocator>
+typename vector<value_type, Allocator>::iterator
+vector<value_type, Allocator>::begin() {
+  return arr_;
+}
+
+template <class value_type, class Allocator>
+typename vector<value_type, Allocator>::iterator
+vector<value_type, Allocator>::end() {
+  return arr_ + size_;
+}
+
+template <class value_type, class Allocator>
+typename vector<value_type, Allocator>::const_iterator
+vector<value_type, Allocator>::begin() const {
   return arr_;
 }
 
-template <class value_type>
-typename vector<value_type>::iterator vector<value_type>::end() {
+template <class value_type, class Allocator>
+typename vector<value_type, Allocator>::const_iterator
+vector<value_type, Allocator>::end() const {
   return arr_ + size_;
 }
 
 //  -------------------------------------------
-template <class value_type>
-bool vector<value_type>::empty() {
+template <class value_type, class Allocator>
+bool vector<value_type, Allocator>::empty() {
   return size_ == 0;
 }
 
-template <class value_type>
-typename vector<value_type>::size_type vector<value_type>::size() {
+template <class value_type, class Allocator>
+typename vector<value_type, Allocator>::size_type
+vector<value_type, Allocator>::size() {
   return size_;
 }
 
-template <class value_type>
-typename vector<value_type>::size_type vector<value_type>::max_size() {
-  return std::numeric_limits<size_type>::max();
+template <class value_type, class Allocator>
+typename vector<value_type, Allocator>::size_type
+vector<value_type, Allocator>::max_size() {
+  return alloc_traits::max_size(alloc_);
 }
 
-template <class value_type>
-void vector<value_type>::reserve(size_type new_capacity) {
+// В отличие от std::vector емкость становится ровно new_capacity, а при
+// new_capacity < size() лишние элементы с конца удаляются. Встроенный буфер
+// small_vector не уменьшается
+template <class value_type, class Allocator>
+void vector<value_type, Allocator>::reserve(size_type new_capacity) {
   if (new_capacity > max_size())
     throw std::out_of_range("reserve: out of range");
-  if (new_capacity < capacity_) size_ = new_capacity;
-
-  value_type *buf = new value_type[new_capacity];
-  std::copy(arr_, arr_ + (capacity_ < new_capacity ? capacity_ : new_capacity),
-            buf);
-  delete[] arr_;
-  arr_ = buf;
-  capacity_ = new_capacity;
+  if (new_capacity == capacity_) return;
+  if (new_capacity < size_) {
+    destroy(arr_ + new_capacity, arr_ + size_);
+    size_ = new_capacity;
+  }
+  if (inline_ && new_capacity < capacity_) return;
+  reallocate(new_capacity);
 }
 
-template <class value_type>
-typename vector<value_type>::size_type vector<value_type>::capacity() {
+template <class value_type, class Allocator>
+typename vector<value_type, Allocator>::size_type
+vector<value_type, Allocator>::capacity() {
   return capacity_;
 }
 
-template <class value_type>
-void vector<value_type>::shrink_to_fit() {
-  capacity_ = size_;
+template <class value_type, class Allocator>
+void vector<value_type, Allocator>::shrink_to_fit() {
+  if (!inline_ && capacity_ > size_) reallocate(size_);
 }
 
-template <class value_type>
-void vector<value_type>::clear() {
+// Память сохраняется для последующих вставок
+template <class value_type, class Allocator>
+void vector<value_type, Allocator>::clear() {
+  destroy(arr_, arr_ + size_);
   size_ = 0;
-  delete[] arr_;
-  arr_ = new value_type[capacity_];
 }
 
-template <class value_type>
-typename vector<value_type>::iterator vector<value_type>::insert(
-    iterator pos, const_reference value) {
+template <class value_type, class Allocator>
+typename vector<value_type, Allocator>::size_type
+vector<value_type, Allocator>::checkedIndex(const_iterator pos) {
   if (pos > end() || pos < begin())
     throw std::out_of_range("insert: out of range");
-  int realpos = (pos - begin());
-  reserve(++size_);
+  return pos - begin();
+}
 
-  for (iterator it = end() - 1; it != begin() + realpos; --it) {
-    *it = *(it - 1);
+// Создаёт элементы dst[i] из args[i]; при исключении созданные разрушаются
+template <class value_type, class Allocator>
+template <class... Args>
+void vector<value_type, Allocator>::constructEach(value_type *dst,
+                                                  Args &&...args) {
+  size_type i = 0;
+  try {
+    ((alloc_traits::construct(alloc_, dst + i, std::forward<Args>(args)), ++i),
+     ...);
+  } catch (...) {
+    destroy(dst, dst + i);
+    throw;
   }
-  *(begin() + realpos) = value;
-  return pos;
 }
 
-template <class value_type>
-void vector<value_type>::erase(iterator pos) {
-  size_type check = pos - arr_;
-  if (check > size_) throw std::out_of_range("erase: out of range");
+// Вставка с перевыделением: новые элементы создаются в новом буфере до
+// переноса старых, поэтому аргументы make могут ссылаться на любые
+// элементы вектора
+template <class value_type, class Allocator>
+template <class Make>
+void vector<value_type, Allocator>::growInsert(size_type index, size_type k,
+                                               Make make) {
+  const size_type new_capacity = nextCapacity(size_ + k);
+  value_type *buf = allocate(new_capacity);
+  try {
+    make(buf + index);
+    try {
+      relocate(*this, buf, index, k);
+    } catch (...) {
+      destroy(buf + index, buf + index + k);
+      throw;
+    }
+  } catch (...) {
+    deallocate(buf, new_capacity);
+    throw;
+  }
+  replaceStorage(buf, new_capacity);
+  size_ += k;
+}
+
+// Общая часть всех вставок: освобождает место под k элементов перед
+// элементом index и создаёт их вызовом make(dst) в неинициализированной
+// памяти dst[0, k). make при исключении сам разрушает созданные им
+// элементы, и вектор остаётся прежним. Если места хватает, хвост
+// сдвигается один раз
+template <class value_type, class Allocator>
+template <class Make>
+typename vector<value_type, Allocator>::iterator
+vector<value_type, Allocator>::insertN(
+    size_type index, size_type k, Make make) {
+  if (k == 0) return begin() + index;
+  if (k > max_size() - size_)
+    throw std::length_error("vector: too many elements");
+
+  if (size_ + k > capacity_) {
+    growInsert(index, k, make);
+    return begin() + index;
+  }
+  if (index == size_) {
+    make(arr_ + size_);
+  } else if constexpr (kBitwiseRelocate) {
+    value_type *gap = arr_ + index;
+    const size_type tail = (size_ - index) * sizeof(value_type);
+    std::memmove(static_cast<void *>(gap + k), gap, tail);
+    try {
+      make(gap);
+    } catch (...) {
+      std::memmove(static_cast<void *>(gap), gap + k, tail);
+      throw;
+    }
+  } else {
+    // Новые элементы создаются в конце и переставляются на место; если
+    // перемещение бросит исключение, гарантия только базовая, как у std
+    make(arr_ + size_);
+    size_ += k;
+    std::rotate(arr_ + index, arr_ + size_ - k, arr_ + size_);
+    return begin() + index;
+  }
+  size_ += k;
+  return begin() + index;
+}
 
-  for (iterator it = pos; it != end() - 1; ++it) {
-    *it = *(it + 1);
+// Вставка K элементов из аргументов, которые могут ссылаться на элементы
+// этого же вектора. Побайтовый сдвиг хвоста в insertN переместил бы такие
+// элементы до создания новых, поэтому для побайтово переносимых типов
+// новые элементы сначала создаются в буфере на стеке
+template <class value_type, class Allocator>
+template <typename vector<value_type, Allocator>::size_type K, class Make>
+typename vector<value_type, Allocator>::iterator
+vector<value_type, Allocator>::insertStaged(size_type index, Make make) {
+  if constexpr (K == 0) {
+    return begin() + index;
+  } else if constexpr (kBitwiseRelocate) {
+    alignas(value_type) unsigned char raw[K * sizeof(value_type)];
+    value_type *staged = reinterpret_cast<value_type *>(raw);
+    make(staged);
+    try {
+      return insertN(index, K, [staged](value_type *dst) {
+        std::memcpy(static_cast<void *>(dst), staged, K * sizeof(value_type));
+      });
+    } catch (...) {
+      destroy(staged, staged + K);
+      throw;
+    }
+  } else {
+    return insertN(index, K, make);
   }
-  --size_;
 }
 
-template <class value_type>
-void vector<value_type>::push_back(const_reference value) {
-  if (size_ + 1 > capacity_) this->reserve(this->size() + 1);
-  ++size_;
-  arr_[size_ - 1] = value;
+template <class value_type, class Allocator>
+typename vector<value_type, Allocator>::iterator
+vector<value_type, Allocator>::insert(
+    const_iterator pos, const_reference value) {
+  return emplace(pos, value);
 }
 
-template <class value_type>
-void vector<value_type>::pop_back() {
-  --size_;
+template <class value_type, class Allocator>
+typename vector<value_type, Allocator>::iterator
+vector<value_type, Allocator>::insert(const_iterator pos, value_type &&value) {
+  return emplace(pos, std::move(value));
 }
 
-template <class value_type>
-void vector<value_type>::swap(vector &other) {
+template <class value_type, class Allocator>
+void vector<value_type, Allocator>::erase(iterator pos) {
+  size_type check = pos - arr_;
+  if (check >= size_) throw std::out_of_range("erase: out of range");
+
+  if constexpr (kBitwiseRelocate) {
+    alloc_traits::destroy(alloc_, pos);
+    std::memmove(static_cast<void *>(pos), pos + 1,
+                 (end() - pos - 1) * sizeof(value_type));
+    --size_;
+  } else {
+    if constexpr (kMoveAssign) {
+      std::move(pos + 1, end(), pos);
+    } else {
+      std::copy(pos + 1, end(), pos);
+    }
+    pop_back();
+  }
+}
+
+template <class value_type, class Allocator>
+void vector<value_type, Allocator>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <class value_type, class Allocator>
+void vector<value_type, Allocator>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <class value_type, class Allocator>
+void vector<value_type, Allocator>::pop_back() {
+  alloc_traits::destroy(alloc_, arr_ + --size_);
+}
+
+template <class value_type, class Allocator>
+void vector<value_type, Allocator>::swap(vector &other) {
+  constexpr bool kPropagate =
+      alloc_traits::propagate_on_container_swap::value;
+  if (inline_ || other.inline_ || (!kPropagate && !(alloc_ == other.alloc_))) {
+    // Встроенный буфер и память чужого распределителя не передаются,
+    // поэтому обмен через перемещения
+    vector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+    return;
+  }
+  if constexpr (kPropagate) {
+    using std::swap;
+    swap(alloc_, other.alloc_);
+  }
   std::swap(this->size_, other.size_);
   std::swap(this->capacity_, other.capacity_);
   std::swap(this->arr_, other.arr_);
 }
 
-template <typename value_type>
+template <class value_type, class Allocator>
 template <typename... Args>
-typename vector<value_type>::iterator vector<value_type>::insert_many(
-    const_iterator pos, Args &&...args) {
-  int realpos = (pos - begin()) - 1;
-  return ((++realpos, insert(begin() + realpos, std::forward<Args>(args))),
-          ...);
+typename vector<value_type, Allocator>::iterator
+vector<value_type, Allocator>::emplace(const_iterator pos, Args &&...args) {
+  return insertStaged<1>(checkedIndex(pos), [&](value_type *dst) {
+    alloc_traits::construct(alloc_, dst, std::forward<Args>(args)...);
+  });
 }
 
-template <typename value_type>
+// При нехватке места емкость растёт в growth_factor раз. Новый элемент
+// создаётся в новом буфере до переноса старых, так как аргументы могут
+// ссылаться на элементы этого же вектора
+template <class value_type, class Allocator>
 template <typename... Args>
-void vector<value_type>::insert_many_back(Args &&...args) {
-  (push_back(std::forward<Args>(args)), ...);
+typename vector<value_type, Allocator>::reference
+vector<value_type, Allocator>::emplace_back(Args &&...args) {
+  if (size_ < capacity_) {
+    alloc_traits::construct(alloc_, arr_ + size_, std::forward<Args>(args)...);
+    ++size_;
+  } else {
+    growInsert(size_, 1U, [&](value_type *dst) {
+      alloc_traits::construct(alloc_, dst, std::forward<Args>(args)...);
+    });
+  }
+  return arr_[size_ - 1];
+}
+
+// Однопроходный диапазон заранее не измерить: элементы добавляются в конец
+// и затем переставляются на место одним std::rotate
+template <class value_type, class Allocator>
+template <class InputIt, class>
+typename vector<value_type, Allocator>::iterator
+vector<value_type, Allocator>::insert(
+    const_iterator pos, InputIt first, InputIt last) {
+  const size_type index = checkedIndex(pos);
+  using Category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (std::is_convertible_v<Category, std::forward_iterator_tag>) {
+    const auto k = static_cast<size_type>(std::distance(first, last));
+    return insertN(index, k, [&](value_type *dst) {
+      value_type *p = dst;
+      try {
+        for (; first != last; ++first, ++p)
+          alloc_traits::construct(alloc_, p, *first);
+      } catch (...) {
+        destroy(dst, p);
+        throw;
+      }
+    });
+  } else {
+    const size_type old_size = size_;
+    for (; first != last; ++first) emplace_back(*first);
+    std::rotate(arr_ + index, arr_ + old_size, arr_ + size_);
+    return begin() + index;
+  }
+}
+
+template <class value_type, class Allocator>
+typename vector<value_type, Allocator>::iterator
+vector<value_type, Allocator>::insert(
+    const_iterator pos, std::initializer_list<value_type> items) {
+  return insert(pos, items.begin(), items.end());
 }
 
+template <class value_type, class Allocator>
+template <class InputIt, class>
+void vector<value_type, Allocator>::append(InputIt first, InputIt last) {
+  insert(end(), first, last);
+}
+
+template <class value_type, class Allocator>
+template <class InputIt, class>
+void vector<value_type, Allocator>::assign(InputIt first, InputIt last) {
+  clear();
+  append(first, last);
+}
+
+template <class value_type, class Allocator>
+void vector<value_type, Allocator>::assign(size_type n, const_reference value) {
+  // value может быть элементом этого же вектора
+  value_type copy(value);
+  clear();
+  insertN(0U, n, [&](value_type *dst) {
+    size_type i = 0;
+    try {
+      for (; i < n; ++i) alloc_traits::construct(alloc_, dst + i, copy);
+    } catch (...) {
+      destroy(dst, dst + i);
+      throw;
+    }
+  });
+}
+
+template <class value_type, class Allocator>
+void vector<value_type, Allocator>::assign(
+    std::initializer_list<value_type> items) {
+  assign(items.begin(), items.end());
+}
+
+template <class value_type, class Allocator>
+template <typename... Args>
+typename vector<value_type, Allocator>::iterator
+vector<value_type, Allocator>::insert_many(const_iterator pos, Args &&...args) {
+  constexpr size_type k = sizeof...(Args);
+  const size_type index = checkedIndex(pos);
+  insertStaged<k>(index, [&](value_type *dst) {
+    constructEach(dst, std::forward<Args>(args)...);
+  });
+  return begin() + index + k - (k > 0);
+}
+
+template <class value_type, class Allocator>
+template <typename... Args>
+void vector<value_type, Allocator>::insert_many_back(Args &&...args) {
+  insertN(size_, sizeof...(Args), [&](value_type *dst) {
+    constructEach(dst, std::forward<Args>(args)...);
+  });
+}
+
+namespace pmr {
+// Вектор, память которого выделяет std::pmr::memory_resource, например
+// s21::pmr::monotonic_arena. Ресурс не передаётся при копировании,
+// присваивании и обмене: копия получает ресурс по умолчанию
+template <class T>
+using vector = s21::vector<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
+
 }  // namespace s21
 #endif
\ No newline at end of file
@@ -0,0 +1,273 @@
+#include <cstdint>
+#include <map>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "tests.h"
+
+using namespace s21;
+
+namespace {
+
+// Распределитель с состоянием: id различает экземпляры, а owners
+// проверяет, что память освобождает тот же распределитель, что её выделил
+std::map<void *, int> owners;
+
+template <class T, bool kPropagate>
+struct Tracking {
+  using value_type = T;
+  using propagate_on_container_copy_assignment =
+      std::bool_constant<kPropagate>;
+  using propagate_on_container_move_assignment =
+      std::bool_constant<kPropagate>;
+  using propagate_on_container_swap = std::bool_constant<kPropagate>;
+  template <class U>
+  struct rebind {
+    using other = Tracking<U, kPropagate>;
+  };
+
+  explicit Tracking(int id = 0) : id(id) {}
+
+  T *allocate(std::size_t n) {
+    T *p = std::allocator<T>().allocate(n);
+    owners[p] = id;
+    return p;
+  }
+  void deallocate(T *p, std::size_t n) {
+    EXPECT_EQ(owners[p], id);
+    owners.erase(p);
+    std::allocator<T>().deallocate(p, n);
+  }
+  // Копия вектора получает новый распределитель
+  Tracking select_on_container_copy_construction() const {
+    return Tracking(id + 100);
+  }
+  bool operator==(const Tracking &other) const { return id == other.id; }
+  bool operator!=(const Tracking &other) const { return id != other.id; }
+
+  int id;
+};
+
+// Копирование бросает исключение на заданном вызове; перемещения нет,
+// поэтому элементы переносятся копированием
+struct ThrowingCopy {
+  static inline int copies = 0;
+  static inline int throw_on_copy = -1;
+  int value;
+
+  ThrowingCopy(int value) : value(value) {}
+  ThrowingCopy(const ThrowingCopy &other) : value(other.value) {
+    if (copies++ == throw_on_copy) throw std::runtime_error("copy");
+  }
+};
+
+// Ресурс, считающий запросы к себе
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  long allocations = 0;
+  long live = 0;
+
+ private:
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+    ++allocations;
+    ++live;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  void do_deallocate(void *p, std::size_t bytes,
+                     std::size_t alignment) override {
+    --live;
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+  bool do_is_equal(
+      const std::pmr::memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+
+}  // namespace
+
+TEST(Allocator, allocator1) {
+  // Распределитель передаётся при копировании, перемещении и обмене
+  using Alloc = Tracking<int, true>;
+  vector<int, Alloc> a({1, 2, 3}, Alloc(1));
+  vector<int, Alloc> copy(a);
+  EXPECT_EQ(copy.get_allocator().id, 101);
+  EXPECT_EQ(copy[2], 3);
+
+  vector<int, Alloc> b({4, 5}, Alloc(2));
+  b = a;
+  EXPECT_EQ(b.get_allocator().id, 1);
+  EXPECT_EQ(b.size(), 3);
+
+  // Буфер забирается целиком вместе с распределителем
+  vector<int, Alloc> c({6}, Alloc(3));
+  int *data = a.data();
+  c = std::move(a);
+  EXPECT_EQ(c.get_allocator().id, 1);
+  EXPECT_EQ(c.data(), data);
+
+  c.swap(copy);
+  EXPECT_EQ(c.get_allocator().id, 101);
+  EXPECT_EQ(copy.get_allocator().id, 1);
+  EXPECT_EQ(copy.data(), data);
+}
+
+TEST(Allocator, allocator2) {
+  // Распределитель не передаётся: между неравными распределителями
+  // элементы переносятся по одному
+  using Alloc = Tracking<std::string, false>;
+  vector<std::string, Alloc> a({"a", "b", "c"}, Alloc(1));
+  vector<std::string, Alloc> b({"x"}, Alloc(2));
+  b = a;
+  EXPECT_EQ(b.get_allocator().id, 2);
+  EXPECT_EQ(b[2], "c");
+
+  std::string *data = a.data();
+  b = std::move(a);
+  EXPECT_EQ(b.get_allocator().id, 2);
+  EXPECT_NE(b.data(), data);
+  EXPECT_EQ(b[0], "a");
+  EXPECT_TRUE(a.empty());
+
+  vector<std::string, Alloc> c(std::move(b), Alloc(3));
+  EXPECT_EQ(c.get_allocator().id, 3);
+  EXPECT_EQ(c.size(), 3);
+  EXPECT_TRUE(b.empty());
+
+  // Равные распределители: буфер забирается целиком
+  data = c.data();
+  vector<std::string, Alloc> d(std::move(c), Alloc(3));
+  EXPECT_EQ(d.data(), data);
+
+  vector<std::string, Alloc> e({"e"}, Alloc(4));
+  d.swap(e);
+  EXPECT_EQ(d.get_allocator().id, 3);
+  EXPECT_EQ(d.size(), 1);
+  EXPECT_EQ(d[0], "e");
+  EXPECT_EQ(e.size(), 3);
+
+  small_vector<std::string, 2, Alloc> inline_list({"p"}, Alloc(5));
+  inline_list.push_back("q");
+  inline_list.push_back("r");
+  EXPECT_EQ(inline_list.get_allocator().id, 5);
+  EXPECT_EQ(owners[inline_list.data()], 5);
+}
+
+TEST(Allocator, small_vector_move) {
+  // После перемещения к неравному распределителю буфер в куче остаётся у
+  // исходного вектора и освобождается вместе с ним
+  using Alloc = Tracking<std::string, false>;
+  const std::size_t allocated = owners.size();
+  {
+    small_vector<std::string, 2, Alloc> a({"a", "b", "c", "d"}, Alloc(1));
+    small_vector<std::string, 2, Alloc> b(Alloc(2));
+    EXPECT_FALSE(a.is_inline());
+    std::string *data = a.data();
+    b = std::move(a);
+    EXPECT_EQ(b.size(), 4);
+    EXPECT_NE(b.data(), data);
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(a.data(), data);
+    a.push_back("e");
+    EXPECT_EQ(owners[a.data()], 1);
+
+    // Равные распределители: буфер забирается, исходный вектор
+    // возвращается во встроенный буфер
+    data = b.data();
+    small_vector<std::string, 2, Alloc> c(std::move(b));
+    EXPECT_EQ(c.data(), data);
+    EXPECT_TRUE(b.is_inline());
+    b.push_back("f");
+    EXPECT_EQ(owners.count(b.data()), 0);
+  }
+  EXPECT_EQ(owners.size(), allocated);
+}
+
+TEST(Allocator, move_throws) {
+  // Исключение при переносе к неравному распределителю: новый буфер
+  // освобождается, исходный вектор не меняется
+  using Alloc = Tracking<ThrowingCopy, false>;
+  const std::size_t allocated = owners.size();
+  {
+    vector<ThrowingCopy, Alloc> v({1, 2, 3, 4, 5}, Alloc(1));
+    ThrowingCopy::copies = 0;
+    ThrowingCopy::throw_on_copy = 2;
+    EXPECT_THROW((vector<ThrowingCopy, Alloc>(std::move(v), Alloc(2))),
+                 std::runtime_error);
+    ThrowingCopy::throw_on_copy = -1;
+    EXPECT_EQ(owners.size(), allocated + 1);
+    EXPECT_EQ(v.size(), 5);
+    EXPECT_EQ(v[4].value, 5);
+  }
+  EXPECT_EQ(owners.size(), allocated);
+}
+
+TEST(Allocator, allocator3) {
+  // Элементы pmr::string получают ресурс вектора
+  CountingResource upstream;
+  pmr::monotonic_arena arena(&upstream);
+  pmr::vector<std::pmr::string> v(&arena);
+  for (int i = 0; i < 100; ++i)
+    v.emplace_back("long string that does not fit into SSO buffer");
+  EXPECT_EQ(v[99].get_allocator().resource(), &arena);
+  EXPECT_GT(upstream.allocations, 1);
+
+  // Копия получает ресурс по умолчанию
+  pmr::vector<std::pmr::string> copy(v);
+  EXPECT_EQ(copy.get_allocator().resource(),
+            std::pmr::get_default_resource());
+  EXPECT_EQ(copy[99], v[99]);
+
+  // Перемещение в вектор другого ресурса переносит элементы
+  pmr::vector<std::pmr::string> moved(std::move(v),
+                                      std::pmr::new_delete_resource());
+  EXPECT_EQ(moved.size(), 100);
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(moved[0].get_allocator().resource(),
+            std::pmr::new_delete_resource());
+}
+
+TEST(Allocator, allocator4) {
+  CountingResource upstream;
+  {
+    alignas(16) char buffer[256];
+    pmr::monotonic_arena arena(buffer, sizeof(buffer), &upstream);
+    void *p = arena.allocate(100, 16);
+    EXPECT_GE(static_cast<char *>(p), buffer);
+    EXPECT_LT(static_cast<char *>(p), buffer + sizeof(buffer));
+    EXPECT_EQ(upstream.allocations, 0);
+
+    // Выравнивание и большие выделения
+    void *aligned = arena.allocate(8, 256);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(aligned) % 256, 0U);
+    void *large = arena.allocate(1 << 20, 8);
+    EXPECT_NE(large, nullptr);
+    EXPECT_GE(upstream.allocations, 1);
+
+    // После reset() тот же набор выделений обходится без ресурса
+    for (int round = 0; round < 3; ++round) {
+      arena.reset();
+      const long before = upstream.allocations;
+      for (int i = 1; i < 64; ++i) {
+        pmr::vector<int> v(&arena);
+        for (int j = 0; j < i * 16; ++j) v.push_back(j);
+        EXPECT_EQ(v[i * 16 - 1], i * 16 - 1);
+      }
+      if (round > 0) {
+        EXPECT_EQ(upstream.allocations, before);
+      }
+    }
+    EXPECT_EQ(upstream.live, 1);
+    EXPECT_GE(arena.capacity(), sizeof(buffer));
+
+    arena.release();
+    EXPECT_EQ(upstream.live, 0);
+    EXPECT_EQ(arena.capacity(), sizeof(buffer));
+    EXPECT_EQ(arena.upstream_resource(), &upstream);
+    EXPECT_NE(arena.allocate(1024, 8), nullptr);
+    EXPECT_EQ(upstream.live, 1);
+  }
+  EXPECT_EQ(upstream.live, 0);
+}
@@ -0,0 +1,106 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include "tests.h"
+
+using namespace s21;
+
+// Подсчёт выделений памяти: std::allocator выделяет память через
+// operator new, который здесь заменён счётчиком
+namespace {
+std::atomic<long> allocations{0};
+
+long Allocations() { return allocations.load(); }
+}  // namespace
+
+void *operator new(std::size_t size) {
+  ++allocations;
+  if (void *ptr = std::malloc(size ? size : 1)) return ptr;
+  throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+TEST(SmallVector, small_vector1) {
+  // Короткие списки живут во встроенном буфере
+  const long before = Allocations();
+  {
+    small_vector<int, 16> v;
+    for (int i = 0; i < 15; ++i) v.push_back(i);
+    small_vector<int, 16> copy(v);
+    small_vector<int, 16> moved(std::move(copy));
+    moved.insert(moved.begin(), -1);
+    moved.erase(moved.begin());
+    v.swap(moved);
+    EXPECT_TRUE(v.is_inline());
+    EXPECT_EQ(v.capacity(), 16);
+    EXPECT_EQ(v[14], 14);
+  }
+  EXPECT_EQ(Allocations(), before);
+}
+
+TEST(SmallVector, small_vector2) {
+  // Переполнение: одно выделение и дальше рост как у s21::vector
+  small_vector<std::string, 4> v{"a", "b", "c", "d"};
+  const long before = Allocations();
+  v.push_back("e");
+  EXPECT_EQ(Allocations(), before + 1);
+  EXPECT_FALSE(v.is_inline());
+  EXPECT_EQ(v.capacity(), 8);
+  EXPECT_EQ(v[0], "a");
+  EXPECT_EQ(v[4], "e");
+
+  // Буфер в куче забирается целиком, источник возвращается во встроенный
+  small_vector<std::string, 4> moved(std::move(v));
+  EXPECT_EQ(Allocations(), before + 1);
+  EXPECT_EQ(moved.size(), 5);
+  EXPECT_TRUE(v.is_inline());
+  EXPECT_TRUE(v.empty());
+  v.push_back("x");
+  EXPECT_EQ(Allocations(), before + 1);
+
+  v.swap(moved);
+  EXPECT_EQ(v.size(), 5);
+  EXPECT_EQ(moved.size(), 1);
+  EXPECT_EQ(moved[0], "x");
+
+  v.reserve(2);
+  EXPECT_EQ(v.size(), 2);
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 2);
+  moved = v;
+  EXPECT_TRUE(moved.is_inline());
+  EXPECT_EQ(moved[1], "b");
+}
+
+TEST(SmallVector, small_vector3) {
+  // small_vector передаётся как s21::vector
+  small_vector<std::string, 2> inline_list{"a", "b"};
+  auto append = [](vector<std::string> &v) { v.push_back("c"); };
+  append(inline_list);
+  EXPECT_EQ(inline_list.size(), 3);
+  EXPECT_FALSE(inline_list.is_inline());
+
+  // Перемещение из встроенного буфера в обычный вектор переносит элементы
+  small_vector<std::string, 4> source{"x", "y"};
+  vector<std::string> target(std::move(source));
+  EXPECT_EQ(target.size(), 2);
+  EXPECT_EQ(target[1], "y");
+  EXPECT_TRUE(source.empty());
+  EXPECT_TRUE(source.is_inline());
+
+  vector<std::string> plain{"p"};
+  plain.swap(source);
+  EXPECT_EQ(plain.size(), 0);
+  EXPECT_EQ(source.size(), 1);
+  EXPECT_EQ(source[0], "p");
+
+  small_vector<int, 3> sized(5);
+  EXPECT_EQ(sized.size(), 5);
+  EXPECT_EQ(sized.capacity(), 5);
+  EXPECT_EQ(sized[4], 0);
+}
@@ -1,3 +1,11 @@
+#include <cmath>
+#include <list>
+#include <sstream>
+#include <tuple>
+#include <string>
+#include <type_traits>
+#include <vector>
+
 #include "tests.h"
 
 using namespace s21;
@@ -203,3 +211,304 @@ TEST(Modifiers, modifier8) {
 //   EXPECT_EQ(v.at(1), 6);
 //   printVec(v);
 // }
+
+//  -------------------------------------------
+
+namespace {
+
+// Считает живые объекты и вызовы конструкторов
+struct Tracked {
+  static inline int alive = 0;
+  static inline int constructed = 0;
+  int value;
+
+  Tracked() : Tracked(0) {}
+  Tracked(int v) : value(v) { ++alive, ++constructed; }
+  Tracked(const Tracked &other) : Tracked(other.value) {}
+  Tracked &operator=(const Tracked &other) = default;
+  ~Tracked() { --alive; }
+
+  static void reset() { alive = constructed = 0; }
+};
+
+}  // namespace
+
+TEST(Growth, growth1) {
+  vector<int> v;
+  int reallocations = 0;
+  for (int i = 0; i < 1000; ++i) {
+    const size_t capacity = v.capacity();
+    v.push_back(i);
+    if (v.capacity() != capacity) {
+      ++reallocations;
+      EXPECT_GE(v.capacity(),
+                static_cast<size_t>(capacity * vector<int>::growth_factor));
+    }
+  }
+  // Число перевыделений логарифмическое: log(1000) по основанию множителя
+  EXPECT_LE(reallocations,
+            std::log(1000.) / std::log(vector<int>::growth_factor) + 2);
+  for (int i = 0; i < 1000; ++i) EXPECT_EQ(v[i], i);
+}
+
+TEST(Growth, growth2) {
+  // Память под емкость не создаёт элементов, создаются только живые
+  Tracked::reset();
+  {
+    vector<Tracked> v;
+    v.reserve(100);
+    EXPECT_EQ(Tracked::constructed, 0);
+    for (int i = 0; i < 10; ++i) v.push_back(Tracked(i));
+    EXPECT_EQ(Tracked::alive, 10);
+    v.pop_back();
+    v.erase(v.begin());
+    EXPECT_EQ(Tracked::alive, 8);
+    EXPECT_EQ(v.front().value, 1);
+    v.clear();
+    EXPECT_EQ(Tracked::alive, 0);
+    EXPECT_EQ(v.capacity(), 100);
+    v.push_back(Tracked(7));
+  }
+  EXPECT_EQ(Tracked::alive, 0);
+}
+
+TEST(Growth, growth3) {
+  // Вставка элемента этого же вектора при перевыделении
+  vector<int> v{1, 2, 3};
+  v.push_back(v[0]);
+  v.insert(v.begin(), v.back());
+  EXPECT_EQ(v.size(), 5);
+  EXPECT_EQ(v[0], 1);
+  EXPECT_EQ(v[4], 1);
+  auto it = v.insert(v.begin() + 2, v[1]);
+  EXPECT_EQ(*it, 1);
+  EXPECT_EQ(v[3], 2);
+}
+
+TEST(Growth, growth4) {
+  Tracked::reset();
+  {
+    vector<Tracked> v(4);
+    EXPECT_EQ(Tracked::alive, 4);
+    v.reserve(16);
+    v.shrink_to_fit();
+    EXPECT_EQ(v.capacity(), 4);
+    v.reserve(2);
+    EXPECT_EQ(Tracked::alive, 2);
+    vector<Tracked> moved(std::move(v));
+    v = std::move(moved);
+    EXPECT_EQ(v.size(), 2);
+  }
+  EXPECT_EQ(Tracked::alive, 0);
+}
+
+//  -------------------------------------------
+
+namespace {
+
+// Считает копирования и перемещения; Noexcept задаёт спецификацию
+// перемещающего конструктора, throw_on_copy — номер копии, бросающей
+// исключение
+template <bool Noexcept>
+struct Counted {
+  static inline int copies = 0;
+  static inline int moves = 0;
+  static inline int throw_on_copy = -1;
+  int value;
+
+  Counted(int v) : value(v) {}
+  Counted(const Counted &other) : value(other.value) {
+    if (copies++ == throw_on_copy) throw std::runtime_error("copy");
+  }
+  Counted(Counted &&other) noexcept(Noexcept) : value(other.value) {
+    ++moves;
+  }
+  Counted &operator=(const Counted &other) = default;
+  Counted &operator=(Counted &&other) noexcept(Noexcept) = default;
+
+  static void reset() { copies = moves = 0, throw_on_copy = -1; }
+};
+
+// Владеет буфером через указатель: побайтовый перенос безопасен
+struct Owning {
+  static inline int destroyed = 0;
+  int *p;
+
+  Owning(int v) : p(new int(v)) {}
+  Owning(const Owning &other) : p(new int(*other.p)) {}
+  Owning(Owning &&other) noexcept : p(std::exchange(other.p, nullptr)) {}
+  Owning &operator=(Owning other) noexcept {
+    std::swap(p, other.p);
+    return *this;
+  }
+  ~Owning() {
+    ++destroyed;
+    delete p;
+  }
+};
+
+}  // namespace
+
+template <>
+struct s21::is_trivially_relocatable<Owning> : std::true_type {};
+
+TEST(Relocation, relocation1) {
+  // Перемещение без исключений: при росте и сдвигах копий нет
+  using Movable = Counted<true>;
+  Movable::reset();
+  vector<Movable> v;
+  for (int i = 0; i < 100; ++i) {
+    const Movable value(i);
+    v.push_back(value);
+  }
+  EXPECT_EQ(Movable::copies, 100);
+  EXPECT_GT(Movable::moves, 0);
+  v.insert(v.begin(), Movable(-1));
+  v.erase(v.begin() + 50);
+  EXPECT_EQ(Movable::copies, 100);
+  EXPECT_EQ(v[0].value, -1);
+  EXPECT_EQ(v[50].value, 50);
+  EXPECT_EQ(v.size(), 100);
+}
+
+TEST(Relocation, relocation2) {
+  // Перемещение может бросить исключение: элементы копируются, и при
+  // исключении во время перевыделения вектор не меняется
+  using Throwing = Counted<false>;
+  Throwing::reset();
+  vector<Throwing> v{1, 2, 3, 4};
+  const int copies = Throwing::copies;
+  Throwing::throw_on_copy = copies + 3;
+  const Throwing five(5);
+  EXPECT_THROW(v.push_back(five), std::runtime_error);
+  EXPECT_EQ(Throwing::moves, 0);
+  EXPECT_EQ(v.size(), 4);
+  EXPECT_EQ(v.capacity(), 4);
+  for (int i = 0; i < 4; ++i) EXPECT_EQ(v[i].value, i + 1);
+}
+
+TEST(Relocation, relocation3) {
+  // Побайтовый перенос: старые объекты не разрушаются
+  Owning::destroyed = 0;
+  {
+    vector<Owning> v;
+    for (int i = 0; i < 33; ++i) v.push_back(Owning(i));
+    const int temporaries = Owning::destroyed;
+    v.reserve(100);
+    v.insert(v.begin() + 1, Owning(-1));
+    v.erase(v.begin());
+    // Временный аргумент insert и удалённый элемент
+    EXPECT_EQ(Owning::destroyed, temporaries + 2);
+    EXPECT_EQ(*v[0].p, -1);
+    EXPECT_EQ(*v[32].p, 32);
+  }
+  EXPECT_EQ(Owning::destroyed, 33 + 2 + 33);
+}
+
+TEST(Relocation, relocation4) {
+  // Вложенные векторы при росте внешнего перемещаются, а не копируются
+  static_assert(std::is_nothrow_move_constructible_v<vector<int>>);
+  static_assert(std::is_nothrow_move_assignable_v<vector<int>>);
+  static_assert(std::is_nothrow_move_constructible_v<small_vector<int, 4>>);
+  vector<vector<int>> v;
+  std::vector<const int *> data;
+  for (int i = 0; i < 100; ++i) {
+    v.push_back(vector<int>{i, i + 1});
+    data.push_back(v[i].data());
+  }
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(v[i].data(), data[i]);
+    EXPECT_EQ(v[i][1], i + 1);
+  }
+}
+
+//  -------------------------------------------
+
+TEST(Emplace, emplace1) {
+  vector<std::pair<int, std::string>> v;
+  auto &back = v.emplace_back(1, "one");
+  EXPECT_EQ(back.second, "one");
+  v.emplace_back(std::piecewise_construct, std::forward_as_tuple(3),
+                 std::forward_as_tuple(3, 'c'));
+  auto it = v.emplace(v.begin() + 1, 2, "two");
+  EXPECT_EQ(it->first, 2);
+  EXPECT_EQ(v[0].second, "one");
+  EXPECT_EQ(v[1].second, "two");
+  EXPECT_EQ(v[2].second, "ccc");
+
+  // Аргумент — элемент этого же вектора, без перевыделения и с ним
+  vector<int> ints{1, 2, 3};
+  ints.reserve(10);
+  ints.emplace(ints.begin(), ints[2]);
+  ints.shrink_to_fit();
+  ints.emplace(ints.begin(), ints[3]);
+  EXPECT_EQ(ints[0], 3);
+  EXPECT_EQ(ints[1], 3);
+  EXPECT_EQ(ints[4], 3);
+}
+
+TEST(Emplace, emplace2) {
+  // Вставка нескольких элементов: одно перевыделение и порядок аргументов
+  vector<std::string> v{"a", "e"};
+  auto it = v.insert_many(v.begin() + 1, "b", std::string("c"), v[0]);
+  EXPECT_EQ(*it, "a");
+  EXPECT_EQ(it - v.begin(), 3);
+  EXPECT_EQ(v.capacity(), 5);
+  v.insert_many_back("f", "g");
+  const char *expected[] = {"a", "b", "c", "a", "e", "f", "g"};
+  ASSERT_EQ(v.size(), 7);
+  for (size_t i = 0; i < v.size(); ++i) EXPECT_EQ(v[i], expected[i]);
+
+  vector<int> ints{1, 5};
+  ints.reserve(8);
+  ints.insert_many(ints.begin() + 1, 2, 3, ints[1]);
+  ints.insert_many_back(6);
+  for (int i = 0; i < 6; ++i) EXPECT_EQ(ints[i], i == 3 ? 5 : i + 1);
+}
+
+TEST(Emplace, emplace3) {
+  // Диапазон с известной длиной: одно перевыделение точно под размер
+  vector<int> v{0, 9};
+  const std::list<int> middle{1, 2, 3, 4, 5, 6, 7, 8};
+  auto it = v.insert(v.begin() + 1, middle.begin(), middle.end());
+  EXPECT_EQ(it, v.begin() + 1);
+  EXPECT_EQ(v.capacity(), 10);
+  for (int i = 0; i < 10; ++i) EXPECT_EQ(v[i], i);
+
+  vector<std::string> s{"x", "z"};
+  s.insert(s.begin() + 1, {"y1", "y2"});
+  s.reserve(10);
+  s.insert(s.end() - 1, {"y3"});
+  EXPECT_EQ(s[3], "y3");
+  EXPECT_EQ(s[4], "z");
+
+  // Однопроходный диапазон
+  std::istringstream in("10 20 30");
+  v.insert(v.begin() + 2, std::istream_iterator<int>(in),
+           std::istream_iterator<int>());
+  EXPECT_EQ(v.size(), 13);
+  EXPECT_EQ(v[1], 1);
+  EXPECT_EQ(v[2], 10);
+  EXPECT_EQ(v[4], 30);
+  EXPECT_EQ(v[5], 2);
+}
+
+TEST(Emplace, emplace4) {
+  std::vector<int> source(1000000);
+  for (size_t i = 0; i < source.size(); ++i) source[i] = i;
+  vector<int> v;
+  v.append(source.begin(), source.end());
+  EXPECT_EQ(v.capacity(), source.size());
+  EXPECT_EQ(v[999999], 999999);
+
+  v.assign({4, 5, 6});
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_EQ(v[2], 6);
+  v.assign(5, v[0]);
+  EXPECT_EQ(v.size(), 5);
+  EXPECT_EQ(v[4], 4);
+  v.assign(source.begin(), source.begin() + 2);
+  EXPECT_EQ(v.size(), 2);
+  EXPECT_EQ(v[1], 1);
+  EXPECT_THROW(v.insert(v.end() + 1, 1), std::out_of_range);
+}